@@ -0,0 +1,609 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_bench.c
+ * \brief   Sigfox EP ADDON RFP host micro-benchmark.
+ * \details Measures the time spent in the addon dispatch, test modes init and process functions
+ *          and messages building, on top of a stub EP library. Results are printed in JSON format.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_rc.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "sigfox_ep_addon_rfp_version.h"
+#include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+#include "test_modes_rfp/sigfox_rfp_timer.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+#include "test_modes_rfp/sigfox_rfp_throughput.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+#include "test_modes_rfp/sigfox_rfp_uplink_timing.h"
+#endif
+#include "sigfox_ep_addon_rfp_bench_stub.h"
+
+/*** SIGFOX EP ADDON RFP BENCH local macros ***/
+
+#define BENCH_DEFAULT_ITERATIONS    1000
+#define BENCH_MAX_STEPS             1000
+
+#if (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT) && (defined SIGFOX_EP_RC5_ZONE)
+#define BENCH_RC    (&SIGFOX_RC5)
+#elif (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT) && (defined SIGFOX_EP_RC3_LBT_ZONE)
+#define BENCH_RC    (&SIGFOX_RC3_LBT)
+#elif (defined SIGFOX_EP_RC1_ZONE)
+#define BENCH_RC    (&SIGFOX_RC1)
+#elif (defined SIGFOX_EP_RC2_ZONE)
+#define BENCH_RC    (&SIGFOX_RC2)
+#elif (defined SIGFOX_EP_RC3_LDC_ZONE)
+#define BENCH_RC    (&SIGFOX_RC3_LDC)
+#elif (defined SIGFOX_EP_RC4_ZONE)
+#define BENCH_RC    (&SIGFOX_RC4)
+#elif (defined SIGFOX_EP_RC6_ZONE)
+#define BENCH_RC    (&SIGFOX_RC6)
+#elif (defined SIGFOX_EP_RC7_ZONE)
+#define BENCH_RC    (&SIGFOX_RC7)
+#else
+#error "Sigfox EP ADDON RFP benchmark requires at least one RC zone"
+#endif
+
+/*** SIGFOX EP ADDON RFP BENCH local structures ***/
+
+typedef struct {
+    const char *name;
+    SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t reference;
+    const SIGFOX_RFP_test_mode_fn_t *test_mode_fn;
+} BENCH_test_mode_t;
+
+typedef struct {
+    struct timespec start;
+    sfx_u32 calls;
+    unsigned long long total_ns;
+} BENCH_measure_t;
+
+/*** SIGFOX EP ADDON RFP BENCH local global variables ***/
+
+// Bidirectional test modes wait for downlink frames which are not emulated by the stub.
+static const BENCH_test_mode_t BENCH_TEST_MODES[] = {
+    {"A", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_A, &SIGFOX_RFP_TEST_MODE_A_fn},
+    {"B", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_B, &SIGFOX_RFP_TEST_MODE_B_fn},
+    {"C", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C, &SIGFOX_RFP_TEST_MODE_C_fn},
+#ifdef SIGFOX_EP_SPECTRUM_ACCESS_LBT
+    {"G", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_G, &SIGFOX_RFP_TEST_MODE_G_fn},
+#endif
+    {"J", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_J, &SIGFOX_RFP_TEST_MODE_J_fn},
+#ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
+    {"K", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_K, &SIGFOX_RFP_TEST_MODE_K_fn},
+#endif
+    {"L", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_L, &SIGFOX_RFP_TEST_MODE_L_fn},
+};
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+static volatile sfx_bool bench_process_flag = SIGFOX_FALSE;
+static volatile sfx_bool bench_cplt_flag = SIGFOX_FALSE;
+#endif
+#if (defined SIGFOX_EP_ASYNCHRONOUS) && (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+static volatile sfx_bool bench_timer_flag = SIGFOX_FALSE;
+#endif
+static sfx_bool bench_first_result = SIGFOX_TRUE;
+
+/*** SIGFOX EP ADDON RFP BENCH local functions ***/
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn static void _process_cb(void)
+ * \brief Addon process callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _process_cb(void) {
+    bench_process_flag = SIGFOX_TRUE;
+}
+
+/*!******************************************************************
+ * \fn static void _cplt_cb(void)
+ * \brief Test mode completion callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _cplt_cb(void) {
+    bench_cplt_flag = SIGFOX_TRUE;
+}
+#endif
+
+#if (defined SIGFOX_EP_ASYNCHRONOUS) && (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+/*!******************************************************************
+ * \fn static void _timer_process_cb(void)
+ * \brief Timer wheel process callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _timer_process_cb(void) {
+    bench_timer_flag = SIGFOX_TRUE;
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+/*!******************************************************************
+ * \fn static sfx_u32 _get_time_us(void)
+ * \brief Microseconds time source of the process budget.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Monotonic time in microseconds.
+ *******************************************************************/
+static sfx_u32 _get_time_us(void) {
+    // Local variables.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (sfx_u32) ((now.tv_sec * 1000000ULL) + (now.tv_nsec / 1000));
+}
+#endif
+
+/*!******************************************************************
+ * \fn static void _measure_start(BENCH_measure_t *measure)
+ * \brief Start a measure.
+ * \param[in]   measure: Measure to start.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _measure_start(BENCH_measure_t *measure) {
+    clock_gettime(CLOCK_MONOTONIC, &(measure->start));
+}
+
+/*!******************************************************************
+ * \fn static void _measure_stop(BENCH_measure_t *measure)
+ * \brief Stop a measure and add its duration to the total.
+ * \param[in]   measure: Measure to stop.
+ * \param[out]  measure: Measure updated with the new call.
+ * \retval      none
+ *******************************************************************/
+static void _measure_stop(BENCH_measure_t *measure) {
+    // Local variables.
+    struct timespec stop;
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    measure->total_ns += ((unsigned long long) (stop.tv_sec - measure->start.tv_sec) * 1000000000ULL);
+    measure->total_ns += (unsigned long long) stop.tv_nsec;
+    measure->total_ns -= (unsigned long long) measure->start.tv_nsec;
+    measure->calls++;
+}
+
+/*!******************************************************************
+ * \fn static void _print_result(const char *test_mode_name, const char *function_name, BENCH_measure_t *measure)
+ * \brief Print the result of a measure as a JSON object.
+ * \param[in]   test_mode_name: Name of the measured test mode.
+ * \param[in]   function_name: Name of the measured function.
+ * \param[in]   measure: Measure to print.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _print_result(const char *test_mode_name, const char *function_name, BENCH_measure_t *measure) {
+    // Local variables.
+    double ns_per_call = (measure->calls == 0) ? 0.0 : ((double) measure->total_ns / (double) measure->calls);
+    printf("%s\n    {\"test_mode\": \"%s\", \"function\": \"%s\", \"calls\": %lu, \"ns_per_call\": %.1f}", (bench_first_result == SIGFOX_TRUE) ? "" : ",", test_mode_name, function_name, (unsigned long) measure->calls, ns_per_call);
+    bench_first_result = SIGFOX_FALSE;
+}
+
+/*!******************************************************************
+ * \fn static void _print_config(void)
+ * \brief Print the compilation flags of the benchmark.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _print_config(void) {
+    printf("  \"version\": \"%s\",\n", SIGFOX_EP_ADDON_RFP_VERSION);
+    printf("  \"config\": {");
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    printf("\"asynchronous\": true, ");
+#else
+    printf("\"asynchronous\": false, ");
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    printf("\"error_codes\": true, ");
+#else
+    printf("\"error_codes\": false, ");
+#endif
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    printf("\"bidirectional\": true, ");
+#else
+    printf("\"bidirectional\": false, ");
+#endif
+#ifdef SIGFOX_EP_SINGLE_FRAME
+    printf("\"single_frame\": true, ");
+#else
+    printf("\"single_frame\": false, ");
+#endif
+#ifdef SIGFOX_EP_REGULATORY
+    printf("\"regulatory\": true, ");
+#else
+    printf("\"regulatory\": false, ");
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    printf("\"parameters_check\": true, ");
+#else
+    printf("\"parameters_check\": false, ");
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    printf("\"energy\": true, ");
+#else
+    printf("\"energy\": false, ");
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    printf("\"planner\": true, ");
+#else
+    printf("\"planner\": false, ");
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+    printf("\"timer_wheel\": true");
+#else
+    printf("\"timer_wheel\": false");
+#endif
+    printf("},\n");
+}
+
+/*!******************************************************************
+ * \fn static void _set_rfp_test_mode(SIGFOX_RFP_test_mode_t *rfp_test_mode)
+ * \brief Set the test mode parameters used by the benchmark.
+ * \param[in]   none
+ * \param[out]  rfp_test_mode: Test mode parameters.
+ * \retval      none
+ *******************************************************************/
+static void _set_rfp_test_mode(SIGFOX_RFP_test_mode_t *rfp_test_mode) {
+    rfp_test_mode->rc = BENCH_RC;
+#ifndef SIGFOX_EP_UL_BIT_RATE_BPS
+    rfp_test_mode->ul_bit_rate = SIGFOX_UL_BIT_RATE_100BPS;
+#endif
+#ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
+    rfp_test_mode->tx_power_dbm_eirp = 14;
+#endif
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    rfp_test_mode->downlink_cplt_cb = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    rfp_test_mode->process_cb = &_process_cb;
+    rfp_test_mode->cplt_cb = &_cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    rfp_test_mode->start_step = 0;
+    rfp_test_mode->start_state = 0;
+    rfp_test_mode->checkpoint_cb = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    rfp_test_mode->early_stop_threshold_percent = 0;
+    rfp_test_mode->early_stop_confidence = SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_95;
+    rfp_test_mode->early_stop_report = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    rfp_test_mode->regulatory_controls = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    rfp_test_mode->lbt_profile = SIGFOX_NULL;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    rfp_test_mode->get_time_ms = &SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+    rfp_test_mode->public_key_report = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    rfp_test_mode->nvm_stress_cycles = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    rfp_test_mode->rx_scan = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    rfp_test_mode->soak = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    rfp_test_mode->single_pass = SIGFOX_FALSE;
+    rfp_test_mode->single_pass_report = SIGFOX_NULL;
+#endif
+}
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn static sfx_bool _is_done(const SIGFOX_RFP_test_mode_fn_t *test_mode_fn)
+ * \brief Check if a test mode is completed or failed.
+ * \param[in]   test_mode_fn: Functions of the test mode.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the test mode is over, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+static sfx_bool _is_done(const SIGFOX_RFP_test_mode_fn_t *test_mode_fn) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status = test_mode_fn->get_progress_status_fn();
+    return ((progress_status.status.error != 0) || (progress_status.progress >= 100)) ? SIGFOX_TRUE : SIGFOX_FALSE;
+}
+#endif
+
+/*!******************************************************************
+ * \fn static void _bench_clock_overhead(sfx_u32 iterations)
+ * \brief Measure the cost of an empty measure.
+ * \param[in]   iterations: Number of measures.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _bench_clock_overhead(sfx_u32 iterations) {
+    // Local variables.
+    BENCH_measure_t empty_measure = {.calls = 0, .total_ns = 0};
+    sfx_u32 iteration = 0;
+    // Cost of an empty measure, to be subtracted from the other results.
+    for (iteration = 0; iteration < iterations; iteration++) {
+        _measure_start(&empty_measure);
+        _measure_stop(&empty_measure);
+    }
+    _print_result("none", "clock_overhead", &empty_measure);
+}
+
+/*!******************************************************************
+ * \fn static void _bench_test_mode_functions(const BENCH_test_mode_t *test_mode, sfx_u32 iterations)
+ * \brief Measure the functions of a test mode called directly.
+ * \param[in]   test_mode: Test mode to measure.
+ * \param[in]   iterations: Number of runs.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _bench_test_mode_functions(const BENCH_test_mode_t *test_mode, sfx_u32 iterations) {
+    // Local variables.
+    SIGFOX_RFP_test_mode_t rfp_test_mode;
+    BENCH_measure_t init_measure = {.calls = 0, .total_ns = 0};
+    BENCH_measure_t send_measure = {.calls = 0, .total_ns = 0};
+    BENCH_measure_t process_measure = {.calls = 0, .total_ns = 0};
+    sfx_u32 iteration = 0;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sfx_u32 step = 0;
+#endif
+    _set_rfp_test_mode(&rfp_test_mode);
+#if (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    SIGFOX_RFP_TIMER_init(&SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms, &_timer_process_cb);
+#elif (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+    SIGFOX_RFP_TIMER_init(&SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    SIGFOX_RFP_THROUGHPUT_reset(&SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+    SIGFOX_RFP_UPLINK_TIMING_reset(&SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms);
+#endif
+    for (iteration = 0; iteration < iterations; iteration++) {
+        SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset();
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        bench_process_flag = SIGFOX_FALSE;
+        bench_cplt_flag = SIGFOX_FALSE;
+#endif
+        _measure_start(&init_measure);
+        test_mode->test_mode_fn->init_fn(&rfp_test_mode);
+        _measure_stop(&init_measure);
+        // First call builds and sends the first message (whole test mode in blocking mode).
+        _measure_start(&send_measure);
+        test_mode->test_mode_fn->process_fn();
+        _measure_stop(&send_measure);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        // Drive the test mode until completion.
+        for (step = 0; step < BENCH_MAX_STEPS; step++) {
+            if (_is_done(test_mode->test_mode_fn) == SIGFOX_TRUE) {
+                break;
+            }
+            if (bench_process_flag == SIGFOX_TRUE) {
+                bench_process_flag = SIGFOX_FALSE;
+                _measure_start(&process_measure);
+                test_mode->test_mode_fn->process_fn();
+                _measure_stop(&process_measure);
+            }
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+            else if (bench_timer_flag == SIGFOX_TRUE) {
+                bench_timer_flag = SIGFOX_FALSE;
+                SIGFOX_RFP_TIMER_process();
+            }
+#endif
+            else if (SIGFOX_EP_ADDON_RFP_BENCH_STUB_flush() == SIGFOX_FALSE) {
+                break;
+            }
+        }
+#endif
+    }
+    _print_result(test_mode->name, "init_fn", &init_measure);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    _print_result(test_mode->name, "send_message", &send_measure);
+    _print_result(test_mode->name, "process_fn", &process_measure);
+#else
+    _print_result(test_mode->name, "process_fn", &send_measure);
+    (void) process_measure;
+#endif
+}
+
+/*!******************************************************************
+ * \fn static void _bench_test_mode_api(const BENCH_test_mode_t *test_mode, sfx_u32 iterations)
+ * \brief Measure a test mode run through the addon API.
+ * \param[in]   test_mode: Test mode to measure.
+ * \param[in]   iterations: Number of runs.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _bench_test_mode_api(const BENCH_test_mode_t *test_mode, sfx_u32 iterations) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_config_t config;
+    SIGFOX_EP_ADDON_RFP_API_test_mode_t api_test_mode;
+    BENCH_measure_t dispatch_measure = {.calls = 0, .total_ns = 0};
+    BENCH_measure_t process_measure = {.calls = 0, .total_ns = 0};
+    sfx_u32 iteration = 0;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sfx_u32 step = 0;
+#endif
+    // Open addon.
+    config.rc = BENCH_RC;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    config.process_cb = &_process_cb;
+#endif
+#ifndef SIGFOX_EP_MESSAGE_COUNTER_ROLLOVER
+    config.message_counter_rollover = SIGFOX_MESSAGE_COUNTER_ROLLOVER_4096;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    config.get_time_ms = &SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    config.energy_model = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    config.step_deadline_margin_ms = 1000;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    config.get_time_us = &_get_time_us;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    config.checkpoint_write = SIGFOX_NULL;
+    config.checkpoint_read = SIGFOX_NULL;
+    config.checkpoint_period = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    config.stream_write = SIGFOX_NULL;
+#endif
+    SIGFOX_EP_ADDON_RFP_API_open(&config);
+    // Test mode parameters.
+    api_test_mode.test_mode_reference = test_mode->reference;
+#ifndef SIGFOX_EP_UL_BIT_RATE_BPS
+    api_test_mode.ul_bit_rate = SIGFOX_UL_BIT_RATE_100BPS;
+#endif
+#ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
+    api_test_mode.tx_power_dbm_eirp = 14;
+#endif
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    api_test_mode.downlink_cplt_cb = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    api_test_mode.test_mode_cplt_cb = &_cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    api_test_mode.early_stop_threshold_percent = 0;
+    api_test_mode.early_stop_confidence = SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_95;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    api_test_mode.regulatory_controls = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    api_test_mode.lbt_profile = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    api_test_mode.nvm_stress_cycles = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    api_test_mode.rx_scan = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    api_test_mode.soak = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+    api_test_mode.voltage_temperature = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    api_test_mode.single_pass = SIGFOX_FALSE;
+#endif
+    for (iteration = 0; iteration < iterations; iteration++) {
+        SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset();
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        bench_process_flag = SIGFOX_FALSE;
+        bench_cplt_flag = SIGFOX_FALSE;
+#endif
+        _measure_start(&dispatch_measure);
+        SIGFOX_EP_ADDON_RFP_API_test_mode(&api_test_mode);
+        _measure_stop(&dispatch_measure);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+        // Drive the addon until the test mode completion.
+        for (step = 0; step < BENCH_MAX_STEPS; step++) {
+            if (bench_cplt_flag == SIGFOX_TRUE) {
+                break;
+            }
+            if (bench_process_flag == SIGFOX_TRUE) {
+                bench_process_flag = SIGFOX_FALSE;
+                _measure_start(&process_measure);
+                SIGFOX_EP_ADDON_RFP_API_process();
+                _measure_stop(&process_measure);
+            }
+            else if (SIGFOX_EP_ADDON_RFP_BENCH_STUB_flush() == SIGFOX_FALSE) {
+                break;
+            }
+        }
+#endif
+    }
+    SIGFOX_EP_ADDON_RFP_API_close();
+    _print_result(test_mode->name, "SIGFOX_EP_ADDON_RFP_API_test_mode", &dispatch_measure);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    _print_result(test_mode->name, "SIGFOX_EP_ADDON_RFP_API_process", &process_measure);
+#else
+    (void) process_measure;
+#endif
+}
+
+/*** SIGFOX EP ADDON RFP BENCH main ***/
+
+/*!******************************************************************
+ * \fn int main(int argc, char *argv[])
+ * \brief Run the benchmark of all the compiled test modes.
+ * \param[in]   argc: Number of arguments.
+ * \param[in]   argv: Arguments, the first one gives the number of iterations.
+ * \param[out]  none
+ * \retval      0 on success, 1 on invalid arguments.
+ *******************************************************************/
+int main(int argc, char *argv[]) {
+    // Local variables.
+    sfx_u32 iterations = BENCH_DEFAULT_ITERATIONS;
+    sfx_u8 idx = 0;
+    // Optional number of iterations.
+    if (argc > 1) {
+        iterations = (sfx_u32) strtoul(argv[1], SIGFOX_NULL, 10);
+        if (iterations == 0) {
+            fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+    printf("{\n");
+    _print_config();
+    printf("  \"iterations\": %lu,\n", (unsigned long) iterations);
+    printf("  \"results\": [");
+    _bench_clock_overhead(iterations);
+    for (idx = 0; idx < (sizeof(BENCH_TEST_MODES) / sizeof(BENCH_test_mode_t)); idx++) {
+        _bench_test_mode_functions(&BENCH_TEST_MODES[idx], iterations);
+        _bench_test_mode_api(&BENCH_TEST_MODES[idx], iterations);
+    }
+    printf("\n  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,346 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_bench_stub.c
+ * \brief   Stub of the Sigfox EP library used by the addon benchmark.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "sigfox_ep_addon_rfp_bench_stub.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_error.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_api_test.h"
+#include "manuf/mcu_api.h"
+
+/*** SIGFOX EP ADDON RFP BENCH STUB local structures ***/
+
+typedef struct {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb;
+    MCU_API_timer_cplt_cb_t timer_cplt_cb;
+#endif
+    SIGFOX_EP_API_message_status_t message_status;
+    sfx_u32 time_ms;
+    sfx_u32 timer_expiry_ms;
+} SIGFOX_EP_ADDON_RFP_BENCH_STUB_context_t;
+
+/*** SIGFOX EP ADDON RFP BENCH STUB local global variables ***/
+
+static SIGFOX_EP_ADDON_RFP_BENCH_STUB_context_t sigfox_ep_addon_rfp_bench_stub_ctx = {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    .message_cplt_cb = SIGFOX_NULL,
+    .timer_cplt_cb = SIGFOX_NULL,
+#endif
+    .message_status.all = 0,
+    .time_ms = 0,
+    .timer_expiry_ms = 0,
+};
+
+/*** SIGFOX EP API stub functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_open(SIGFOX_EP_API_config_t *config)
+ * \brief Stub of the EP library open function.
+ * \param[in]   config: Library configuration (ignored).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_open(SIGFOX_EP_API_config_t *config) {
+    (void) config;
+    SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset();
+#ifdef SIGFOX_EP_ERROR_CODES
+    return SIGFOX_EP_API_SUCCESS;
+#endif
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_close(void)
+ * \brief Stub of the EP library close function.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_close(void) {
+    SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset();
+#ifdef SIGFOX_EP_ERROR_CODES
+    return SIGFOX_EP_API_SUCCESS;
+#endif
+}
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_process(void)
+ * \brief Stub of the EP library process function.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_process(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    return SIGFOX_EP_API_SUCCESS;
+#endif
+}
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_message_status_t SIGFOX_EP_API_get_message_status(void)
+ * \brief Stub of the EP library message status function.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Status of the last message.
+ *******************************************************************/
+SIGFOX_EP_API_message_status_t SIGFOX_EP_API_get_message_status(void) {
+    return sigfox_ep_addon_rfp_bench_stub_ctx.message_status;
+}
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_get_dl_payload(sfx_u8 *dl_payload, sfx_u8 dl_payload_size, sfx_s16 *dl_rssi_dbm)
+ * \brief Stub of the EP library downlink payload function, which returns an empty payload.
+ * \param[in]   dl_payload_size: Size of the downlink payload buffer.
+ * \param[out]  dl_payload: Downlink payload.
+ * \param[out]  dl_rssi_dbm: RSSI of the downlink frame.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_get_dl_payload(sfx_u8 *dl_payload, sfx_u8 dl_payload_size, sfx_s16 *dl_rssi_dbm) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    for (idx = 0; idx < dl_payload_size; idx++) {
+        dl_payload[idx] = 0;
+    }
+    (*dl_rssi_dbm) = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    return SIGFOX_EP_API_SUCCESS;
+#endif
+}
+#endif
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_TEST_send_application_message(SIGFOX_EP_API_application_message_t *application_message, SIGFOX_EP_API_TEST_parameters_t *test_parameters)
+ * \brief Stub of the EP library test application message function.
+ * \param[in]   application_message: Message to send, only the completion callback is kept.
+ * \param[in]   test_parameters: Test parameters (ignored).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_TEST_send_application_message(SIGFOX_EP_API_application_message_t *application_message, SIGFOX_EP_API_TEST_parameters_t *test_parameters) {
+    (void) test_parameters;
+    sigfox_ep_addon_rfp_bench_stub_ctx.message_status.all = 0;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_bench_stub_ctx.message_cplt_cb = application_message->message_cplt_cb;
+#else
+    (void) application_message;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return SIGFOX_EP_API_SUCCESS;
+#endif
+}
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_EP_API_TEST_send_control_message(SIGFOX_EP_API_control_message_t *control_message, SIGFOX_EP_API_TEST_parameters_t *test_parameters)
+ * \brief Stub of the EP library test control message function.
+ * \param[in]   control_message: Message to send, only the completion callback is kept.
+ * \param[in]   test_parameters: Test parameters (ignored).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_EP_API_TEST_send_control_message(SIGFOX_EP_API_control_message_t *control_message, SIGFOX_EP_API_TEST_parameters_t *test_parameters) {
+    (void) test_parameters;
+    sigfox_ep_addon_rfp_bench_stub_ctx.message_status.all = 0;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_bench_stub_ctx.message_cplt_cb = control_message->message_cplt_cb;
+#else
+    (void) control_message;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return SIGFOX_EP_API_SUCCESS;
+#endif
+}
+#endif
+
+/*** MCU API stub functions ***/
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_timer_start(MCU_API_timer_t *timer)
+ * \brief Stub of the MCU timer start function, based on the simulated time.
+ * \param[in]   timer: Timer parameters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_timer_start(MCU_API_timer_t *timer) {
+    sigfox_ep_addon_rfp_bench_stub_ctx.timer_expiry_ms = sigfox_ep_addon_rfp_bench_stub_ctx.time_ms + timer->duration_ms;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_bench_stub_ctx.timer_cplt_cb = timer->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return MCU_API_SUCCESS;
+#endif
+}
+
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_timer_stop(MCU_API_timer_instance_t timer_instance)
+ * \brief Stub of the MCU timer stop function.
+ * \param[in]   timer_instance: Timer to stop (ignored).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_timer_stop(MCU_API_timer_instance_t timer_instance) {
+    (void) timer_instance;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_bench_stub_ctx.timer_cplt_cb = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return MCU_API_SUCCESS;
+#endif
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_get_voltage_temperature(sfx_u16 *voltage_idle_mv, sfx_u16 *voltage_tx_mv, sfx_s16 *temperature_tenth_degrees)
+ * \brief Stub of the MCU voltage and temperature function, which returns constant values.
+ * \param[in]   none
+ * \param[out]  voltage_idle_mv: Idle supply voltage.
+ * \param[out]  voltage_tx_mv: Supply voltage during the last uplink frame.
+ * \param[out]  temperature_tenth_degrees: Temperature.
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_get_voltage_temperature(sfx_u16 *voltage_idle_mv, sfx_u16 *voltage_tx_mv, sfx_s16 *temperature_tenth_degrees) {
+    (*voltage_idle_mv) = 3300;
+    (*voltage_tx_mv) = 3100;
+    (*temperature_tenth_degrees) = 250;
+#ifdef SIGFOX_EP_ERROR_CODES
+    return MCU_API_SUCCESS;
+#endif
+}
+#endif
+
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_timer_wait_cplt(MCU_API_timer_instance_t timer_instance)
+ * \brief Stub of the MCU timer wait function, which moves the simulated time to the timer expiration.
+ * \param[in]   timer_instance: Timer to wait (ignored).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_timer_wait_cplt(MCU_API_timer_instance_t timer_instance) {
+    (void) timer_instance;
+    sigfox_ep_addon_rfp_bench_stub_ctx.time_ms = sigfox_ep_addon_rfp_bench_stub_ctx.timer_expiry_ms;
+#ifdef SIGFOX_EP_ERROR_CODES
+    return MCU_API_SUCCESS;
+#endif
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+/*!******************************************************************
+ * \fn MCU_API_status_t MCU_API_get_nvm(sfx_u8 *nvm_data, sfx_u8 nvm_data_size_bytes)
+ * \brief Stub of the MCU NVM read function, which returns a blank NVM.
+ * \param[in]   nvm_data_size_bytes: Number of bytes to read.
+ * \param[out]  nvm_data: NVM content.
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t MCU_API_get_nvm(sfx_u8 *nvm_data, sfx_u8 nvm_data_size_bytes) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    // NVM content is not modelled.
+    for (idx = 0; idx < nvm_data_size_bytes; idx++) {
+        nvm_data[idx] = 0;
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    return MCU_API_SUCCESS;
+#endif
+}
+#endif
+
+/*** SIGFOX EP ADDON RFP BENCH STUB functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset(void)
+ * \brief Drop all the pending stub events.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset(void) {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_bench_stub_ctx.message_cplt_cb = SIGFOX_NULL;
+    sigfox_ep_addon_rfp_bench_stub_ctx.timer_cplt_cb = SIGFOX_NULL;
+#endif
+    sigfox_ep_addon_rfp_bench_stub_ctx.message_status.all = 0;
+}
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_EP_ADDON_RFP_BENCH_STUB_flush(void)
+ * \brief Raise the next pending stub event (message completion first, then timer completion).
+ * \brief In blocking mode, events are completed synchronously and this function never raises anything.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if an event has been raised, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_EP_ADDON_RFP_BENCH_STUB_flush(void) {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Local variables.
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb = sigfox_ep_addon_rfp_bench_stub_ctx.message_cplt_cb;
+    MCU_API_timer_cplt_cb_t timer_cplt_cb = sigfox_ep_addon_rfp_bench_stub_ctx.timer_cplt_cb;
+    // Message completes before the timer window.
+    if (message_cplt_cb != SIGFOX_NULL) {
+        sigfox_ep_addon_rfp_bench_stub_ctx.message_cplt_cb = SIGFOX_NULL;
+        message_cplt_cb();
+        return SIGFOX_TRUE;
+    }
+    if (timer_cplt_cb != SIGFOX_NULL) {
+        sigfox_ep_addon_rfp_bench_stub_ctx.timer_cplt_cb = SIGFOX_NULL;
+        sigfox_ep_addon_rfp_bench_stub_ctx.time_ms = sigfox_ep_addon_rfp_bench_stub_ctx.timer_expiry_ms;
+        timer_cplt_cb();
+        return SIGFOX_TRUE;
+    }
+#endif
+    return SIGFOX_FALSE;
+}
+
+/*!******************************************************************
+ * \fn sfx_u32 SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms(void)
+ * \brief Virtual millisecond counter, which jumps to the timer deadline when the stub timer expires.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current virtual time.
+ *******************************************************************/
+sfx_u32 SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms(void) {
+    return sigfox_ep_addon_rfp_bench_stub_ctx.time_ms;
+}
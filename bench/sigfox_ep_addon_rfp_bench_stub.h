@@ -0,0 +1,77 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_bench_stub.h
+ * \brief   Stub of the Sigfox EP library used by the addon benchmark.
+ * \details Replaces the EP and MCU APIs with instantaneous implementations
+ *          so that the benchmark only measures the addon code.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __SIGFOX_EP_ADDON_RFP_BENCH_STUB_H__
+#define __SIGFOX_EP_ADDON_RFP_BENCH_STUB_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+
+/*** SIGFOX EP ADDON RFP BENCH STUB functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset(void)
+ * \brief Drop all the pending stub events.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset(void);
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_EP_ADDON_RFP_BENCH_STUB_flush(void)
+ * \brief Raise the next pending stub event (message completion first, then timer completion).
+ * \brief In blocking mode, events are completed synchronously and this function never raises anything.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if an event has been raised, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_EP_ADDON_RFP_BENCH_STUB_flush(void);
+
+/*!******************************************************************
+ * \fn sfx_u32 SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms(void)
+ * \brief Virtual millisecond counter, which jumps to the timer deadline when the stub timer expires.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current virtual time.
+ *******************************************************************/
+sfx_u32 SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms(void);
+
+#endif /* __SIGFOX_EP_ADDON_RFP_BENCH_STUB_H__ */
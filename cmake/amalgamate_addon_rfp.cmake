@@ -0,0 +1,93 @@
+################################################################################
+#
+# Copyright (c) 2024, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+#Script mode (cmake -P) generating a single translation unit from the addon sources
+#Inputs : AMALGAM_SOURCE_DIR, AMALGAM_SOURCES (list separated by '|'), AMALGAM_OUTPUT
+#The file scope static symbols and typedefs defined in more than one source are renamed with the source name as prefix
+#The local macros of each source are undefined after its inclusion
+cmake_minimum_required(VERSION 3.15)
+string(REPLACE "|" ";" AMALGAM_SOURCES "${AMALGAM_SOURCES}")
+
+#List the static symbols, typedefs and macros of each source
+set(AMALGAM_ALL_SYMBOLS "")
+foreach(X IN LISTS AMALGAM_SOURCES)
+    get_filename_component(UNIT ${X} NAME_WE)
+    set(SYMBOLS_${UNIT} "")
+    set(MACROS_${UNIT} "")
+    file(STRINGS "${AMALGAM_SOURCE_DIR}/${X}" LINES REGEX "^(static |} *[A-Za-z_]| *#define )")
+    foreach(LINE IN LISTS LINES)
+        if(LINE MATCHES "^static [^(=]*[ *]([A-Za-z_][A-Za-z0-9_]*) *(\\(|=|\\[|$)")
+            list(APPEND SYMBOLS_${UNIT} ${CMAKE_MATCH_1})
+        elseif(LINE MATCHES "^} *([A-Za-z_][A-Za-z0-9_]*) *;")
+            list(APPEND SYMBOLS_${UNIT} ${CMAKE_MATCH_1})
+        elseif(LINE MATCHES "^ *#define +([A-Za-z_][A-Za-z0-9_]*)")
+            list(APPEND MACROS_${UNIT} ${CMAKE_MATCH_1})
+        endif()
+    endforeach()
+    list(REMOVE_DUPLICATES SYMBOLS_${UNIT})
+    list(REMOVE_DUPLICATES MACROS_${UNIT})
+    list(APPEND AMALGAM_ALL_SYMBOLS ${SYMBOLS_${UNIT}})
+endforeach()
+
+#Keep the symbols defined in several sources
+set(AMALGAM_DUPLICATED_SYMBOLS "")
+set(AMALGAM_SEEN_SYMBOLS "")
+foreach(SYMBOL IN LISTS AMALGAM_ALL_SYMBOLS)
+    if(SYMBOL IN_LIST AMALGAM_SEEN_SYMBOLS)
+        list(APPEND AMALGAM_DUPLICATED_SYMBOLS ${SYMBOL})
+    else()
+        list(APPEND AMALGAM_SEEN_SYMBOLS ${SYMBOL})
+    endif()
+endforeach()
+list(REMOVE_DUPLICATES AMALGAM_DUPLICATED_SYMBOLS)
+
+#Write the amalgamated source
+set(CONTENT "/* Generated file, do not edit: single translation unit of the Sigfox EP RF & Protocol addon sources. */\n")
+foreach(X IN LISTS AMALGAM_SOURCES)
+    get_filename_component(UNIT ${X} NAME_WE)
+    set(RENAMED_SYMBOLS "")
+    foreach(SYMBOL IN LISTS SYMBOLS_${UNIT})
+        if(SYMBOL IN_LIST AMALGAM_DUPLICATED_SYMBOLS)
+            list(APPEND RENAMED_SYMBOLS ${SYMBOL})
+        endif()
+    endforeach()
+    string(APPEND CONTENT "\n/*** ${X} ***/\n")
+    foreach(SYMBOL IN LISTS RENAMED_SYMBOLS)
+        string(APPEND CONTENT "#define ${SYMBOL} ${UNIT}${SYMBOL}\n")
+    endforeach()
+    string(APPEND CONTENT "#include \"${AMALGAM_SOURCE_DIR}/${X}\"\n")
+    foreach(SYMBOL IN LISTS RENAMED_SYMBOLS MACROS_${UNIT})
+        string(APPEND CONTENT "#undef ${SYMBOL}\n")
+    endforeach()
+endforeach()
+
+file(WRITE "${AMALGAM_OUTPUT}" "${CONTENT}")
@@ -0,0 +1,203 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_stream_decoder.c
+ * \brief   Host decoder of the Sigfox addon RF & Protocol result stream
+ * \details This file reassembles and decodes the TLV records of the result stream received on the
+ *          test station link. It only depends on the C standard library and on the stream format header.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include "sigfox_ep_addon_rfp_stream_decoder.h"
+
+#include <stdint.h>
+#include "sigfox_ep_addon_rfp_stream.h"
+
+/*** SIGFOX EP ADDON RFP STREAM DECODER local functions ***/
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t _decode_record(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder)
+ * \brief Decode the completed record and give it to the record callback.
+ * \param[in]   decoder: Decoder instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t _decode_record(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t status = SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_t record;
+    uint8_t length = decoder->header[1];
+    uint8_t idx = 0;
+    record.tag = decoder->header[0];
+    switch (record.tag) {
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_START:
+        if (length < SIGFOX_EP_ADDON_RFP_STREAM_START_SIZE_BYTES) {
+            return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_RECORD_SIZE;
+        }
+        record.value.start.version = decoder->value[0];
+        record.value.start.test_mode_reference = decoder->value[1];
+        if (record.value.start.version > SIGFOX_EP_ADDON_RFP_STREAM_VERSION) {
+            status = SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_VERSION;
+        }
+        break;
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_MESSAGE:
+        if (length < SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_SIZE_BYTES) {
+            return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_RECORD_SIZE;
+        }
+        record.value.message.status = decoder->value[0];
+        record.value.message.number_of_ul_frames = (uint8_t) (((record.value.message.status & SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_UL_FRAME_1) ? 1 : 0) + ((record.value.message.status & SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_UL_FRAME_2) ? 1 : 0) + ((record.value.message.status & SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_UL_FRAME_3) ? 1 : 0));
+        break;
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_DOWNLINK:
+        if (length < 2) {
+            return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_RECORD_SIZE;
+        }
+        record.value.downlink.rssi_dbm = (int16_t) ((((uint16_t) decoder->value[0]) << 8) | decoder->value[1]);
+        record.value.downlink.payload_size_bytes = (uint8_t) (length - 2);
+        if (record.value.downlink.payload_size_bytes > sizeof(record.value.downlink.payload)) {
+            record.value.downlink.payload_size_bytes = (uint8_t) sizeof(record.value.downlink.payload);
+        }
+        for (idx = 0; idx < record.value.downlink.payload_size_bytes; idx++) {
+            record.value.downlink.payload[idx] = decoder->value[2 + idx];
+        }
+        break;
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_VOLTAGE_TEMPERATURE:
+        if (length < SIGFOX_EP_ADDON_RFP_STREAM_VOLTAGE_TEMPERATURE_SIZE_BYTES) {
+            return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_RECORD_SIZE;
+        }
+        record.value.voltage_temperature.voltage_idle_mv = (uint16_t) ((((uint16_t) decoder->value[0]) << 8) | decoder->value[1]);
+        record.value.voltage_temperature.voltage_tx_mv = (uint16_t) ((((uint16_t) decoder->value[2]) << 8) | decoder->value[3]);
+        record.value.voltage_temperature.temperature_tenth_degrees = (int16_t) ((((uint16_t) decoder->value[4]) << 8) | decoder->value[5]);
+        break;
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_END:
+        if (length < SIGFOX_EP_ADDON_RFP_STREAM_END_SIZE_BYTES) {
+            return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_RECORD_SIZE;
+        }
+        record.value.end.progress = (uint8_t) (decoder->value[0] & SIGFOX_EP_ADDON_RFP_STREAM_END_PROGRESS_MASK);
+        record.value.end.error = (uint8_t) ((decoder->value[0] & SIGFOX_EP_ADDON_RFP_STREAM_END_ERROR) ? 1 : 0);
+        record.value.end.status = decoder->value[1];
+        break;
+    default:
+        // Record of a newer stream version.
+        decoder->number_of_unknown_records++;
+        return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS;
+    }
+    decoder->number_of_records++;
+    if (decoder->record_cb != 0) {
+        decoder->record_cb(&record, decoder->user_data);
+    }
+    return status;
+}
+
+/*** SIGFOX EP ADDON RFP STREAM DECODER functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_init(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_cb_t record_cb, void *user_data)
+ * \brief Initialize a decoder at the beginning of a record.
+ * \param[in]   decoder: Decoder instance.
+ * \param[in]   record_cb: Called for each decoded record.
+ * \param[in]   user_data: Given back to the record callback.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_init(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_cb_t record_cb, void *user_data) {
+    if (decoder == 0) {
+        return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_NULL_PARAMETER;
+    }
+    decoder->record_cb = record_cb;
+    decoder->user_data = user_data;
+    decoder->index = 0;
+    decoder->number_of_records = 0;
+    decoder->number_of_unknown_records = 0;
+    return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_feed(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, const uint8_t *data, uint32_t data_size_bytes)
+ * \brief Decode the bytes received from the link. The record callback is called for each completed record.
+ * \brief On error, the remaining bytes are still decoded and the last error is returned.
+ * \param[in]   decoder: Decoder instance.
+ * \param[in]   data: Received bytes.
+ * \param[in]   data_size_bytes: Number of received bytes.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_feed(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, const uint8_t *data, uint32_t data_size_bytes) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t status = SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t record_status = SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS;
+    uint32_t idx = 0;
+    if ((decoder == 0) || ((data == 0) && (data_size_bytes != 0))) {
+        return SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_NULL_PARAMETER;
+    }
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        if (decoder->index < SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES) {
+            decoder->header[decoder->index] = data[idx];
+        }
+        else {
+            decoder->value[decoder->index - SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES] = data[idx];
+        }
+        decoder->index++;
+        // Check if the record is complete.
+        if ((decoder->index >= SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES) && (decoder->index == (SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES + decoder->header[1]))) {
+            decoder->index = 0;
+            record_status = _decode_record(decoder);
+            if (record_status != SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS) {
+                status = record_status;
+            }
+        }
+    }
+    return status;
+}
+
+/*!******************************************************************
+ * \fn const char *SIGFOX_EP_ADDON_RFP_STREAM_DECODER_get_tag_name(uint8_t tag)
+ * \brief Get a printable name of a record tag.
+ * \param[in]   tag: Record tag.
+ * \param[out]  none
+ * \retval      Name of the tag, "UNKNOWN" for a tag of a newer stream version.
+ *******************************************************************/
+const char *SIGFOX_EP_ADDON_RFP_STREAM_DECODER_get_tag_name(uint8_t tag) {
+    switch (tag) {
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_START:
+        return "START";
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_MESSAGE:
+        return "MESSAGE";
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_DOWNLINK:
+        return "DOWNLINK";
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_VOLTAGE_TEMPERATURE:
+        return "VOLTAGE_TEMPERATURE";
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_END:
+        return "END";
+    default:
+        return "UNKNOWN";
+    }
+}
@@ -0,0 +1,146 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_stream_decoder.h
+ * \brief   Host decoder of the Sigfox addon RF & Protocol result stream
+ * \details This file reassembles and decodes the TLV records of the result stream received on the
+ *          test station link. It only depends on the C standard library and on the stream format header.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_EP_ADDON_RFP_STREAM_DECODER_H__
+#define __SIGFOX_EP_ADDON_RFP_STREAM_DECODER_H__
+
+#include <stdint.h>
+#include "sigfox_ep_addon_rfp_stream.h"
+
+/*** SIGFOX EP ADDON RFP STREAM DECODER structures ***/
+
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t
+ * \brief Stream decoder error codes.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS = 0,
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_NULL_PARAMETER,
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_VERSION, /*!< Start record of a newer stream version, the records are decoded as far as they are known */
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_ERROR_RECORD_SIZE, /*!< Known record shorter than expected, the record is dropped */
+} SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_t
+ * \brief Decoded record. Only the field matching the tag is valid.
+ *******************************************************************/
+typedef struct {
+    uint8_t tag;
+    union {
+        struct {
+            uint8_t version;
+            uint8_t test_mode_reference; /*!< SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t value */
+        } start;
+        struct {
+            uint8_t status; /*!< SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_xxx bits */
+            uint8_t number_of_ul_frames;
+        } message;
+        struct {
+            int16_t rssi_dbm;
+            uint8_t payload_size_bytes;
+            uint8_t payload[SIGFOX_EP_ADDON_RFP_STREAM_DOWNLINK_SIZE_BYTES - 2];
+        } downlink;
+        struct {
+            uint16_t voltage_idle_mv;
+            uint16_t voltage_tx_mv; /*!< 0 when the message did not send any uplink frame */
+            int16_t temperature_tenth_degrees;
+        } voltage_temperature;
+        struct {
+            uint8_t progress;
+            uint8_t error;
+            uint8_t status; /*!< SIGFOX_EP_ADDON_RFP_API_status_t value, or SIGFOX_EP_ADDON_RFP_STREAM_STATUS_ERROR */
+        } end;
+    } value;
+} SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_t;
+
+/*!******************************************************************
+ * \brief Stream decoder record callback.
+ * \fn SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_cb_t: Called for each complete record with a known tag.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_cb_t)(const SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_t *record, void *user_data);
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t
+ * \brief Stream decoder instance. A record can be split over several calls of the feed function.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_cb_t record_cb;
+    void *user_data;
+    uint8_t header[SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES];
+    uint8_t value[255];
+    uint16_t index; /*!< Bytes received of the current record */
+    uint32_t number_of_records;
+    uint32_t number_of_unknown_records;
+} SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t;
+
+/*** SIGFOX EP ADDON RFP STREAM DECODER functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_init(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_cb_t record_cb, void *user_data)
+ * \brief Initialize a decoder at the beginning of a record.
+ * \param[in]   decoder: Decoder instance.
+ * \param[in]   record_cb: Called for each decoded record.
+ * \param[in]   user_data: Given back to the record callback.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_init(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_record_cb_t record_cb, void *user_data);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_feed(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, const uint8_t *data, uint32_t data_size_bytes)
+ * \brief Decode the bytes received from the link. The record callback is called for each completed record.
+ * \brief On error, the remaining bytes are still decoded and the last error is returned.
+ * \param[in]   decoder: Decoder instance.
+ * \param[in]   data: Received bytes.
+ * \param[in]   data_size_bytes: Number of received bytes.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_STREAM_DECODER_status_t SIGFOX_EP_ADDON_RFP_STREAM_DECODER_feed(SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, const uint8_t *data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn const char *SIGFOX_EP_ADDON_RFP_STREAM_DECODER_get_tag_name(uint8_t tag)
+ * \brief Get a printable name of a record tag.
+ * \param[in]   tag: Record tag.
+ * \param[out]  none
+ * \retval      Name of the tag, "UNKNOWN" for a tag of a newer stream version.
+ *******************************************************************/
+const char *SIGFOX_EP_ADDON_RFP_STREAM_DECODER_get_tag_name(uint8_t tag);
+
+#endif /* __SIGFOX_EP_ADDON_RFP_STREAM_DECODER_H__ */
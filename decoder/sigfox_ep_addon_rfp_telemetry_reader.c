@@ -0,0 +1,249 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_telemetry_reader.c
+ * \brief   Host reader of the Sigfox addon RF & Protocol telemetry segment
+ * \details This file maps the telemetry segment of a station in read-only mode. The status is read in place from the
+ *          segment and the new records are given to a stream decoder, without any system call per update.
+ *          It only depends on the C standard library, on POSIX shared memory and on the format headers.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "sigfox_ep_addon_rfp_telemetry_reader.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "sigfox_ep_addon_rfp_telemetry.h"
+#include "sigfox_ep_addon_rfp_stream_decoder.h"
+
+/*** SIGFOX EP ADDON RFP TELEMETRY READER local macros ***/
+
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_RETRY_MAX  100000
+
+/*** SIGFOX EP ADDON RFP TELEMETRY READER local functions ***/
+
+/*!******************************************************************
+ * \fn static const SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *_get_segment_header(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader)
+ * \brief Get the header mapped at the beginning of the segment.
+ * \param[in]   reader: Reader instance.
+ * \param[out]  none
+ * \retval      Pointer to the shared header.
+ *******************************************************************/
+static const SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *_get_segment_header(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader) {
+    return (const SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *) reader->segment;
+}
+
+/*!******************************************************************
+ * \fn static void _resync(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, uint64_t write_offset)
+ * \brief Drop the overwritten bytes and restart at the given record boundary.
+ * \param[in]   reader: Reader instance.
+ * \param[in]   decoder: Stream decoder.
+ * \param[in]   write_offset: Write offset of the segment.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _resync(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder, uint64_t write_offset) {
+    reader->number_of_lost_bytes += (write_offset - reader->read_offset);
+    reader->read_offset = write_offset;
+    // Drop the partial record of the decoder.
+    decoder->index = 0;
+}
+
+/*** SIGFOX EP ADDON RFP TELEMETRY READER functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, const char *name)
+ * \brief Map the telemetry segment of a station. The records still held by the ring are read first when no record was overwritten yet,
+ * \brief otherwise the reader starts at the newest record.
+ * \param[in]   reader: Reader instance.
+ * \param[in]   name: POSIX shared memory object name given to the station.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, const char *name) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t status = SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS;
+    const SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *segment_header;
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t header;
+    struct stat segment_stat;
+    void *segment = MAP_FAILED;
+    int fd = -1;
+    if ((reader == 0) || (name == 0)) {
+        return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_NULL_PARAMETER;
+    }
+    reader->segment = 0;
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_SEGMENT;
+    }
+    if ((fstat(fd, &segment_stat) == 0) && (segment_stat.st_size >= (off_t) (SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES + SIGFOX_EP_ADDON_RFP_TELEMETRY_RING_SIZE_MIN_BYTES))) {
+        segment = mmap(0, (size_t) segment_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    // The mapping remains valid after closing the descriptor.
+    close(fd);
+    if (segment == MAP_FAILED) {
+        return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_SEGMENT;
+    }
+    reader->segment = (const uint8_t *) segment;
+    reader->segment_size_bytes = (uint32_t) segment_stat.st_size;
+    // Check segment format.
+    segment_header = _get_segment_header(reader);
+    if ((__atomic_load_n(&(segment_header->magic), __ATOMIC_ACQUIRE) != SIGFOX_EP_ADDON_RFP_TELEMETRY_MAGIC) ||
+        (segment_header->version != SIGFOX_EP_ADDON_RFP_TELEMETRY_VERSION) ||
+        (segment_header->header_size_bytes != SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES) ||
+        (reader->segment_size_bytes != (SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES + segment_header->ring_size_bytes))) {
+        SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_close(reader);
+        return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_SEGMENT;
+    }
+    reader->ring_size_bytes = segment_header->ring_size_bytes;
+    reader->number_of_lost_bytes = 0;
+    // Start at the oldest record when the ring did not wrap yet, otherwise no record boundary is known before the newest one.
+    status = SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_get_header(reader, &header);
+    if (status != SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS) {
+        SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_close(reader);
+        return status;
+    }
+    reader->read_offset = (header.write_offset <= reader->ring_size_bytes) ? 0 : header.write_offset;
+    return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_close(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader)
+ * \brief Unmap the telemetry segment.
+ * \param[in]   reader: Reader instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_close(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader) {
+    if ((reader == 0) || (reader->segment == 0)) {
+        return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_NULL_PARAMETER;
+    }
+    munmap((void *) reader->segment, (size_t) reader->segment_size_bytes);
+    reader->segment = 0;
+    return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_get_header(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header)
+ * \brief Get a consistent snapshot of the segment header (state, test mode, progress status and counters).
+ * \param[in]   reader: Reader instance.
+ * \param[out]  header: Pointer that will contain the header snapshot.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_get_header(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *segment_header;
+    uint32_t sequence = 0;
+    uint32_t retry = 0;
+    if ((reader == 0) || (reader->segment == 0) || (header == 0)) {
+        return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_NULL_PARAMETER;
+    }
+    segment_header = _get_segment_header(reader);
+    for (retry = 0; retry < SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_RETRY_MAX; retry++) {
+        sequence = __atomic_load_n(&(segment_header->sequence), __ATOMIC_ACQUIRE);
+        if ((sequence & 0x01) != 0) {
+            continue;
+        }
+        memcpy(header, segment_header, sizeof(SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t));
+        // The copy is valid if the writer did not start an update meanwhile.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&(segment_header->sequence), __ATOMIC_RELAXED) == sequence) {
+            header->sequence = sequence;
+            return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS;
+        }
+    }
+    return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_BUSY;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_read_records(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder)
+ * \brief Give the records written since the last call to a stream decoder. The record callback of the decoder is called for each record.
+ * \brief On overrun, the lost bytes are counted and the reading restarts at the newest record.
+ * \param[in]   reader: Reader instance.
+ * \param[in]   decoder: Stream decoder initialized by the aggregator.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_read_records(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t status = SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t header;
+    const SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *segment_header;
+    const uint8_t *ring;
+    uint64_t write_offset = 0;
+    uint32_t size_bytes = 0;
+    uint32_t position = 0;
+    uint32_t first_size_bytes = 0;
+    if ((reader == 0) || (reader->segment == 0) || (decoder == 0)) {
+        return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_NULL_PARAMETER;
+    }
+    segment_header = _get_segment_header(reader);
+    ring = reader->segment + SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES;
+    // All the bytes before the write offset of a consistent header are written.
+    status = SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_get_header(reader, &header);
+    if (status != SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS) {
+        return status;
+    }
+    if ((header.write_offset - reader->read_offset) > reader->ring_size_bytes) {
+        _resync(reader, decoder, header.write_offset);
+        status = SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_OVERRUN;
+    }
+    while (reader->read_offset < header.write_offset) {
+        // Copy the next chunk out of the ring.
+        size_bytes = (uint32_t) (header.write_offset - reader->read_offset);
+        if (size_bytes > sizeof(reader->buffer)) {
+            size_bytes = sizeof(reader->buffer);
+        }
+        position = (uint32_t) (reader->read_offset % reader->ring_size_bytes);
+        first_size_bytes = reader->ring_size_bytes - position;
+        if (first_size_bytes > size_bytes) {
+            first_size_bytes = size_bytes;
+        }
+        memcpy(reader->buffer, &(ring[position]), first_size_bytes);
+        memcpy(&(reader->buffer[first_size_bytes]), ring, size_bytes - first_size_bytes);
+        // The writer publishes its write offset before overwriting the ring: the copy is valid if it is still less than one ring ahead.
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        write_offset = __atomic_load_n(&(segment_header->write_offset), __ATOMIC_RELAXED);
+        if ((write_offset - reader->read_offset) > reader->ring_size_bytes) {
+            _resync(reader, decoder, write_offset);
+            return SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_OVERRUN;
+        }
+        if (SIGFOX_EP_ADDON_RFP_STREAM_DECODER_feed(decoder, reader->buffer, size_bytes) != SIGFOX_EP_ADDON_RFP_STREAM_DECODER_SUCCESS) {
+            status = SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_DECODER;
+        }
+        reader->read_offset += size_bytes;
+    }
+    return status;
+}
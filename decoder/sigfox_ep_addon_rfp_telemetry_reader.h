@@ -0,0 +1,118 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_telemetry_reader.h
+ * \brief   Host reader of the Sigfox addon RF & Protocol telemetry segment
+ * \details This file maps the telemetry segment of a station in read-only mode. The status is read in place from the
+ *          segment and the new records are given to a stream decoder, without any system call per update.
+ *          It only depends on the C standard library, on POSIX shared memory and on the format headers.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_H__
+#define __SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_H__
+
+#include <stdint.h>
+#include "sigfox_ep_addon_rfp_telemetry.h"
+#include "sigfox_ep_addon_rfp_stream_decoder.h"
+
+/*** SIGFOX EP ADDON RFP TELEMETRY READER structures ***/
+
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t
+ * \brief Telemetry reader error codes.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_SUCCESS = 0,
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_NULL_PARAMETER,
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_SEGMENT, /*!< Segment not found, not initialized yet or of another version */
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_BUSY, /*!< The writer kept the segment locked during all the retries (it may have died while updating it) */
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_OVERRUN, /*!< The writer overwrote records which were not read yet, the reader restarted at the newest record */
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_ERROR_DECODER, /*!< The stream decoder returned an error */
+} SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t
+ * \brief Telemetry reader instance, one per station.
+ *******************************************************************/
+typedef struct {
+    const uint8_t *segment;
+    uint32_t segment_size_bytes;
+    uint32_t ring_size_bytes;
+    uint64_t read_offset; /*!< Next record to give to the decoder */
+    uint64_t number_of_lost_bytes;
+    uint8_t buffer[SIGFOX_EP_ADDON_RFP_TELEMETRY_RING_SIZE_MIN_BYTES];
+} SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t;
+
+/*** SIGFOX EP ADDON RFP TELEMETRY READER functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, const char *name)
+ * \brief Map the telemetry segment of a station. The records still held by the ring are read first when no record was overwritten yet,
+ * \brief otherwise the reader starts at the newest record.
+ * \param[in]   reader: Reader instance.
+ * \param[in]   name: POSIX shared memory object name given to the station.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, const char *name);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_close(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader)
+ * \brief Unmap the telemetry segment.
+ * \param[in]   reader: Reader instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_close(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_get_header(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header)
+ * \brief Get a consistent snapshot of the segment header (state, test mode, progress status and counters).
+ * \param[in]   reader: Reader instance.
+ * \param[out]  header: Pointer that will contain the header snapshot.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_get_header(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_read_records(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder)
+ * \brief Give the records written since the last call to a stream decoder. The record callback of the decoder is called for each record.
+ * \brief On overrun, the lost bytes are counted and the reading restarts at the newest record.
+ * \param[in]   reader: Reader instance.
+ * \param[in]   decoder: Stream decoder initialized by the aggregator.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_read_records(SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_t *reader, SIGFOX_EP_ADDON_RFP_STREAM_DECODER_t *decoder);
+
+#endif /* __SIGFOX_EP_ADDON_RFP_TELEMETRY_READER_H__ */
@@ -0,0 +1,435 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_command_pty.c
+ * \brief   Sigfox EP ADDON RFP command front-end over a pseudo terminal.
+ * \details Loopback example: the device side serves the command front-end on the master side of a
+ *          pseudo terminal, on top of the stub EP library, and the host side drives it from the slave device.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_rc.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "sigfox_ep_addon_rfp_command.h"
+#include "sigfox_ep_addon_rfp_bench_stub.h"
+
+/*** SIGFOX EP ADDON RFP COMMAND PTY local macros ***/
+
+// The stub completes one radio or timer operation per period, so that a test mode lasts long enough to be aborted.
+#define PTY_POLL_PERIOD_MS          10
+#define PTY_REPLY_TIMEOUT_MS        5000
+#define PTY_FRAME_SIZE_MAX_BYTES    (SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES + 255)
+
+#if (defined SIGFOX_EP_RC1_ZONE)
+#define PTY_RC  (&SIGFOX_RC1)
+#elif (defined SIGFOX_EP_RC2_ZONE)
+#define PTY_RC  (&SIGFOX_RC2)
+#elif (defined SIGFOX_EP_RC3_LDC_ZONE)
+#define PTY_RC  (&SIGFOX_RC3_LDC)
+#elif (defined SIGFOX_EP_RC3_LBT_ZONE)
+#define PTY_RC  (&SIGFOX_RC3_LBT)
+#elif (defined SIGFOX_EP_RC4_ZONE)
+#define PTY_RC  (&SIGFOX_RC4)
+#elif (defined SIGFOX_EP_RC5_ZONE)
+#define PTY_RC  (&SIGFOX_RC5)
+#elif (defined SIGFOX_EP_RC6_ZONE)
+#define PTY_RC  (&SIGFOX_RC6)
+#elif (defined SIGFOX_EP_RC7_ZONE)
+#define PTY_RC  (&SIGFOX_RC7)
+#else
+#error "Sigfox EP ADDON RFP command example requires at least one RC zone"
+#endif
+
+/*** SIGFOX EP ADDON RFP COMMAND PTY local global variables ***/
+
+static const SIGFOX_rc_t * const PTY_RC_TABLE[] = {PTY_RC};
+
+static int pty_master_fd = -1;
+static volatile sfx_bool pty_process_flag = SIGFOX_FALSE;
+
+/*** SIGFOX EP ADDON RFP COMMAND PTY local functions ***/
+
+/*!******************************************************************
+ * \fn static void _print_frame(const char *prefix, sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Print a frame in hexadecimal.
+ * \param[in]   prefix: Direction of the frame.
+ * \param[in]   data: Frame bytes.
+ * \param[in]   data_size_bytes: Frame size.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _print_frame(const char *prefix, sfx_u8 *data, sfx_u8 data_size_bytes) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    printf("%s", prefix);
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        printf(" %02X", data[idx]);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+/*!******************************************************************
+ * \fn static sfx_u32 _get_time_us(void)
+ * \brief Microseconds time source of the process budget.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Monotonic time in microseconds.
+ *******************************************************************/
+static sfx_u32 _get_time_us(void) {
+    // Local variables.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (sfx_u32) ((now.tv_sec * 1000000ULL) + (now.tv_nsec / 1000));
+}
+#endif
+
+/*!******************************************************************
+ * \fn static void _device_process_cb(void)
+ * \brief Command front-end process callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _device_process_cb(void) {
+    pty_process_flag = SIGFOX_TRUE;
+}
+
+/*!******************************************************************
+ * \fn static void _device_reply(sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Write a frame of the command front-end to the pseudo terminal.
+ * \param[in]   data: Frame bytes.
+ * \param[in]   data_size_bytes: Frame size.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _device_reply(sfx_u8 *data, sfx_u8 data_size_bytes) {
+    // Local variables.
+    ssize_t written = 0;
+    // The pseudo terminal buffer is large compared to the reply frames.
+    while (data_size_bytes > 0) {
+        written = write(pty_master_fd, data, data_size_bytes);
+        if (written <= 0) {
+            break;
+        }
+        data += written;
+        data_size_bytes = (sfx_u8) (data_size_bytes - written);
+    }
+}
+
+/*!******************************************************************
+ * \fn static int _device_run(void)
+ * \brief Run the device side of the pseudo terminal until the host side is closed.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 on success, 1 if the command front-end could not be initialized.
+ *******************************************************************/
+static int _device_run(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_config_t addon_config;
+    SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode;
+    SIGFOX_EP_ADDON_RFP_COMMAND_config_t command_config;
+    struct pollfd master_poll;
+    sfx_u8 rx_buffer[SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES];
+    ssize_t rx_size = 0;
+    // Addon configuration: the RC, message counter rollover and process callback are given by the front-end.
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    addon_config.get_time_ms = &SIGFOX_EP_ADDON_RFP_BENCH_STUB_get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    addon_config.energy_model = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    addon_config.step_deadline_margin_ms = 1000;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    addon_config.get_time_us = &_get_time_us;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    addon_config.checkpoint_write = SIGFOX_NULL;
+    addon_config.checkpoint_read = SIGFOX_NULL;
+    addon_config.checkpoint_period = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    addon_config.stream_write = SIGFOX_NULL;
+#endif
+    // Test mode options: the reference, bit rate and TX power are given by the front-end, which also sends the completion event.
+    test_mode.test_mode_cplt_cb = SIGFOX_NULL;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    test_mode.downlink_cplt_cb = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    test_mode.early_stop_threshold_percent = 0;
+    test_mode.early_stop_confidence = SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_95;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    test_mode.regulatory_controls = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    test_mode.lbt_profile = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    test_mode.nvm_stress_cycles = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    test_mode.rx_scan = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    test_mode.soak = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+    test_mode.voltage_temperature = SIGFOX_FALSE;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    test_mode.single_pass = SIGFOX_FALSE;
+#endif
+    command_config.rc_table = PTY_RC_TABLE;
+    command_config.number_of_rc = (sfx_u8) (sizeof(PTY_RC_TABLE) / sizeof(PTY_RC_TABLE[0]));
+    command_config.addon_config = &addon_config;
+    command_config.test_mode = &test_mode;
+    command_config.process_cb = &_device_process_cb;
+    command_config.reply = &_device_reply;
+    SIGFOX_EP_ADDON_RFP_BENCH_STUB_reset();
+#ifdef SIGFOX_EP_ERROR_CODES
+    if (SIGFOX_EP_ADDON_RFP_COMMAND_init(&command_config) != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+        fprintf(stderr, "command front-end init failed\n");
+        return 1;
+    }
+#else
+    SIGFOX_EP_ADDON_RFP_COMMAND_init(&command_config);
+#endif
+    // The bytes are received and processed in the same loop, so that the front-end is only called from this thread.
+    // The loop ends when the host side closes the slave device.
+    master_poll.fd = pty_master_fd;
+    master_poll.events = POLLIN;
+    while (1) {
+        if (poll(&master_poll, 1, PTY_POLL_PERIOD_MS) > 0) {
+            if ((master_poll.revents & POLLIN) != 0) {
+                rx_size = read(pty_master_fd, rx_buffer, sizeof(rx_buffer));
+                if (rx_size > 0) {
+                    SIGFOX_EP_ADDON_RFP_COMMAND_receive(rx_buffer, (sfx_u8) rx_size);
+                }
+            }
+            if ((master_poll.revents & (POLLHUP | POLLERR)) != 0) {
+                break;
+            }
+        }
+        else {
+            SIGFOX_EP_ADDON_RFP_BENCH_STUB_flush();
+        }
+        while (pty_process_flag == SIGFOX_TRUE) {
+            pty_process_flag = SIGFOX_FALSE;
+            SIGFOX_EP_ADDON_RFP_COMMAND_process();
+        }
+    }
+    return 0;
+}
+
+/*!******************************************************************
+ * \fn static sfx_bool _host_read(int fd, sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Read a given number of bytes from the host side.
+ * \param[in]   fd: Host side file descriptor.
+ * \param[in]   data_size_bytes: Number of bytes to read.
+ * \param[out]  data: Received bytes.
+ * \retval      SIGFOX_TRUE if all the bytes were received, SIGFOX_FALSE on timeout or error.
+ *******************************************************************/
+static sfx_bool _host_read(int fd, sfx_u8 *data, sfx_u8 data_size_bytes) {
+    // Local variables.
+    struct pollfd slave_poll;
+    ssize_t rx_size = 0;
+    sfx_u8 idx = 0;
+    slave_poll.fd = fd;
+    slave_poll.events = POLLIN;
+    while (idx < data_size_bytes) {
+        if ((poll(&slave_poll, 1, PTY_REPLY_TIMEOUT_MS) <= 0) || ((slave_poll.revents & POLLIN) == 0)) {
+            return SIGFOX_FALSE;
+        }
+        rx_size = read(fd, &(data[idx]), (size_t) (data_size_bytes - idx));
+        if (rx_size <= 0) {
+            return SIGFOX_FALSE;
+        }
+        idx = (sfx_u8) (idx + rx_size);
+    }
+    return SIGFOX_TRUE;
+}
+
+/*!******************************************************************
+ * \fn static sfx_bool _host_wait(int fd, sfx_u8 identifier, sfx_u8 *status)
+ * \brief Wait for a given frame, printing the frames received before.
+ * \param[in]   fd: Host side file descriptor.
+ * \param[in]   identifier: Identifier of the expected frame.
+ * \param[out]  status: Status byte of the frame.
+ * \retval      SIGFOX_TRUE if the frame was received, SIGFOX_FALSE on timeout or error.
+ *******************************************************************/
+static sfx_bool _host_wait(int fd, sfx_u8 identifier, sfx_u8 *status) {
+    // Local variables.
+    sfx_u8 frame[PTY_FRAME_SIZE_MAX_BYTES];
+    // Print all the frames until the expected one, events may come before the reply.
+    while (1) {
+        if (_host_read(fd, frame, SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES) == SIGFOX_FALSE) {
+            break;
+        }
+        if (_host_read(fd, &(frame[SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES]), frame[1]) == SIGFOX_FALSE) {
+            break;
+        }
+        _print_frame("  <-", frame, (sfx_u8) (SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES + frame[1]));
+        if (frame[0] == identifier) {
+            (*status) = (frame[1] > 0) ? frame[SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES] : SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+            return SIGFOX_TRUE;
+        }
+    }
+    printf("  timeout waiting for %02X\n", identifier);
+    return SIGFOX_FALSE;
+}
+
+/*!******************************************************************
+ * \fn static sfx_bool _host_command(int fd, const char *name, sfx_u8 *frame, sfx_u8 frame_size_bytes, sfx_u8 *status)
+ * \brief Send a command and wait for its reply.
+ * \param[in]   fd: Host side file descriptor.
+ * \param[in]   name: Name of the command.
+ * \param[in]   frame: Command frame.
+ * \param[in]   frame_size_bytes: Command frame size.
+ * \param[out]  status: Status byte of the reply.
+ * \retval      SIGFOX_TRUE if the reply was received, SIGFOX_FALSE on timeout or error.
+ *******************************************************************/
+static sfx_bool _host_command(int fd, const char *name, sfx_u8 *frame, sfx_u8 frame_size_bytes, sfx_u8 *status) {
+    printf("%s\n", name);
+    _print_frame("  ->", frame, frame_size_bytes);
+    if (write(fd, frame, frame_size_bytes) != (ssize_t) frame_size_bytes) {
+        return SIGFOX_FALSE;
+    }
+    return _host_wait(fd, (sfx_u8) (frame[0] | SIGFOX_EP_ADDON_RFP_COMMAND_REPLY), status);
+}
+
+/*!******************************************************************
+ * \fn static void *_host_run(void *arg)
+ * \brief Host thread: run a sequence of commands and close the host side.
+ * \param[in]   arg: Host side file descriptor.
+ * \param[out]  none
+ * \retval      SIGFOX_NULL.
+ *******************************************************************/
+static void *_host_run(void *arg) {
+    // Local variables.
+    int slave_fd = (int) ((intptr_t) arg);
+    sfx_u8 status = SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+    sfx_u8 open_frame[] = {SIGFOX_EP_ADDON_RFP_COMMAND_OPEN, SIGFOX_EP_ADDON_RFP_COMMAND_OPEN_SIZE_BYTES, 0, SIGFOX_MESSAGE_COUNTER_ROLLOVER_4096};
+    sfx_u8 test_mode_a_frame[] = {SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE, SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE_SIZE_BYTES, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_A, SIGFOX_UL_BIT_RATE_100BPS, 14};
+    sfx_u8 test_mode_j_frame[] = {SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE, SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE_SIZE_BYTES, SIGFOX_EP_ADDON_RFP_API_TEST_MODE_J, SIGFOX_UL_BIT_RATE_100BPS, 14};
+    sfx_u8 get_result_frame[] = {SIGFOX_EP_ADDON_RFP_COMMAND_GET_RESULT, SIGFOX_EP_ADDON_RFP_COMMAND_GET_RESULT_SIZE_BYTES};
+    sfx_u8 abort_frame[] = {SIGFOX_EP_ADDON_RFP_COMMAND_ABORT, SIGFOX_EP_ADDON_RFP_COMMAND_ABORT_SIZE_BYTES};
+    sfx_u8 close_frame[] = {SIGFOX_EP_ADDON_RFP_COMMAND_CLOSE, SIGFOX_EP_ADDON_RFP_COMMAND_CLOSE_SIZE_BYTES};
+    // Open the addon with the first RC.
+    if ((_host_command(slave_fd, "open", open_frame, sizeof(open_frame), &status) == SIGFOX_FALSE) || (status != SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS)) goto end;
+    // Run the test mode A until its completion event.
+    if ((_host_command(slave_fd, "test mode A", test_mode_a_frame, sizeof(test_mode_a_frame), &status) == SIGFOX_FALSE) || (status != SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS)) goto end;
+    if (_host_wait(slave_fd, SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_TEST_MODE_CPLT, &status) == SIGFOX_FALSE) goto end;
+    if (_host_command(slave_fd, "get result", get_result_frame, sizeof(get_result_frame), &status) == SIGFOX_FALSE) goto end;
+    // Start the test mode J and abort it: the completion event is sent once the EP library is released.
+    if ((_host_command(slave_fd, "test mode J", test_mode_j_frame, sizeof(test_mode_j_frame), &status) == SIGFOX_FALSE) || (status != SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS)) goto end;
+    if (_host_command(slave_fd, "abort", abort_frame, sizeof(abort_frame), &status) == SIGFOX_FALSE) goto end;
+    // The test mode may already be completed when the abort is received.
+    if (status == SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS) {
+        if (_host_wait(slave_fd, SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_TEST_MODE_CPLT, &status) == SIGFOX_FALSE) goto end;
+    }
+    _host_command(slave_fd, "close", close_frame, sizeof(close_frame), &status);
+end:
+    // Hang up the device side.
+    close(slave_fd);
+    return SIGFOX_NULL;
+}
+
+/*** SIGFOX EP ADDON RFP COMMAND PTY functions ***/
+
+/*!******************************************************************
+ * \fn int main(void)
+ * \brief Run a host thread and the device side over a pseudo terminal.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 on success, 1 on error.
+ *******************************************************************/
+int main(void) {
+    // Local variables.
+    int slave_fd = -1;
+    struct termios slave_termios;
+    pthread_t host_thread;
+    int ret = 1;
+    // Open the pseudo terminal.
+    pty_master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((pty_master_fd < 0) || (grantpt(pty_master_fd) != 0) || (unlockpt(pty_master_fd) != 0) || (ptsname(pty_master_fd) == SIGFOX_NULL)) {
+        perror("posix_openpt");
+        goto errors;
+    }
+    printf("slave device: %s\n", ptsname(pty_master_fd));
+    // The host side opens the slave device like a serial port, in raw mode so that the frames bytes are not interpreted.
+    slave_fd = open(ptsname(pty_master_fd), O_RDWR | O_NOCTTY);
+    if ((slave_fd < 0) || (tcgetattr(slave_fd, &slave_termios) != 0)) {
+        perror("open slave");
+        goto errors;
+    }
+    cfmakeraw(&slave_termios);
+    if (tcsetattr(slave_fd, TCSANOW, &slave_termios) != 0) {
+        perror("tcsetattr");
+        goto errors;
+    }
+    if (pthread_create(&host_thread, SIGFOX_NULL, &_host_run, (void *) ((intptr_t) slave_fd)) != 0) {
+        perror("pthread_create");
+        goto errors;
+    }
+    // The slave device is now owned by the host thread.
+    slave_fd = -1;
+    ret = _device_run();
+    pthread_join(host_thread, SIGFOX_NULL);
+errors:
+    if (slave_fd >= 0) {
+        close(slave_fd);
+    }
+    if (pty_master_fd >= 0) {
+        close(pty_master_fd);
+    }
+    return ret;
+}
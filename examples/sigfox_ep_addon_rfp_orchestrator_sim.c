@@ -0,0 +1,250 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_orchestrator_sim.c
+ * \brief   Sigfox EP ADDON RFP orchestrator with simulated devices.
+ * \details Example backend of the orchestrator: each station drives a simulated device which sleeps
+ *          for a scaled and randomized duration of the test mode instead of running it.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L // nanosleep and rand_r with a strict C standard.
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "sigfox_ep_addon_rfp_orchestrator.h"
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR SIM local macros ***/
+
+// One minute of test mode lasts this number of milliseconds on the simulated devices.
+#define SIM_MS_PER_MINUTE           10
+// The simulated duration is the estimated one with a random deviation of +/- this percentage.
+#define SIM_DEVIATION_PERCENT       30
+#define SIM_NUMBER_OF_DEVICES       3
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR SIM local structures ***/
+
+typedef struct {
+    const char *name;
+    SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t reference;
+    sfx_u32 estimated_minutes; // Would be given by SIGFOX_EP_ADDON_RFP_API_plan_test_mode() with the planner.
+} SIM_test_mode_t;
+
+typedef struct {
+    const char *name;
+    sfx_u8 capabilities;
+    unsigned int seed; // Only used by the thread of the station.
+} SIM_station_t;
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR SIM local global variables ***/
+
+static const SIM_test_mode_t SIM_TEST_MODES[] = {
+    {"C", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C, 1},
+    {"J", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_J, 20},
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    {"F", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F, 5},
+    {"D", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_D, 10},
+    {"E", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_E, 15},
+#endif
+    {"A", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_A, 3},
+    {"B", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_B, 90},
+#ifdef SIGFOX_EP_SPECTRUM_ACCESS_LBT
+    {"G", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_G, 12},
+#endif
+#ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
+    {"K", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_K, 1},
+#endif
+    {"L", SIGFOX_EP_ADDON_RFP_API_TEST_MODE_L, 2},
+};
+
+#define SIM_NUMBER_OF_TEST_MODES    (sizeof(SIM_TEST_MODES) / sizeof(SIM_test_mode_t))
+#define SIM_NUMBER_OF_JOBS          (SIM_NUMBER_OF_DEVICES * SIM_NUMBER_OF_TEST_MODES)
+
+static SIM_station_t sim_stations[] = {
+    {"shield box", SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_BIDIRECTIONAL | SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_LBT, 1},
+    {"downlink bench", SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_BIDIRECTIONAL, 2},
+    {"uplink bench 1", 0, 3},
+    {"uplink bench 2", 0, 4},
+};
+
+#define SIM_NUMBER_OF_STATIONS      (sizeof(sim_stations) / sizeof(SIM_station_t))
+
+static SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t sim_jobs[SIM_NUMBER_OF_JOBS];
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR SIM local functions ***/
+
+/*!******************************************************************
+ * \fn static const SIM_test_mode_t *_get_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t reference)
+ * \brief Get the simulation parameters of a test mode.
+ * \param[in]   reference: Test mode reference.
+ * \param[out]  none
+ * \retval      Simulation parameters, SIGFOX_NULL if the test mode is not simulated.
+ *******************************************************************/
+static const SIM_test_mode_t *_get_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t reference) {
+    // Local variables.
+    sfx_u32 idx = 0;
+    for (idx = 0; idx < SIM_NUMBER_OF_TEST_MODES; idx++) {
+        if (SIM_TEST_MODES[idx].reference == reference) {
+            return &(SIM_TEST_MODES[idx]);
+        }
+    }
+    return SIGFOX_NULL;
+}
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_progress_status_t _run_test_mode(void *backend, SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode)
+ * \brief Simulate a test mode run on a station.
+ * \param[in]   backend: Simulated station.
+ * \param[in]   test_mode: Test mode to run.
+ * \param[out]  none
+ * \retval      Progress status of the test mode.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_API_progress_status_t _run_test_mode(void *backend, SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode) {
+    // Local variables.
+    SIM_station_t *station = (SIM_station_t *) backend;
+    const SIM_test_mode_t *sim_test_mode = _get_test_mode(test_mode->test_mode_reference);
+    SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
+    struct timespec duration;
+    sfx_u32 duration_ms = 0;
+    sfx_s32 deviation_percent = 0;
+    progress_status.status.error = 0;
+    progress_status.progress = 100;
+    if (sim_test_mode == SIGFOX_NULL) {
+        progress_status.status.error = 1;
+        progress_status.progress = 0;
+        return progress_status;
+    }
+    // The device runs the test mode for a random duration around the estimation.
+    deviation_percent = (sfx_s32) (rand_r(&(station->seed)) % ((2 * SIM_DEVIATION_PERCENT) + 1)) - SIM_DEVIATION_PERCENT;
+    duration_ms = (sim_test_mode->estimated_minutes * SIM_MS_PER_MINUTE * (sfx_u32) (100 + deviation_percent)) / 100;
+    duration.tv_sec = (time_t) (duration_ms / 1000);
+    duration.tv_nsec = (long) ((duration_ms % 1000) * 1000000);
+    nanosleep(&duration, SIGFOX_NULL);
+    return progress_status;
+}
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR SIM functions ***/
+
+/*!******************************************************************
+ * \fn int main(void)
+ * \brief Run a campaign of jobs on simulated stations and print the reports.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      0 on success, 1 on error.
+ *******************************************************************/
+int main(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t orchestrator;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t station_config;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t station_report;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t status = SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job = SIGFOX_NULL;
+    sfx_u32 total_ms = 0;
+    sfx_u32 makespan_ms = 0;
+    sfx_u32 idx = 0;
+    int ret = 1;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_init(&orchestrator);
+    // Stations.
+    for (idx = 0; idx < SIM_NUMBER_OF_STATIONS; idx++) {
+        station_config.run_test_mode = &_run_test_mode;
+        station_config.backend = (void *) &(sim_stations[idx]);
+        station_config.capabilities = sim_stations[idx].capabilities;
+        status = SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_add_station(&orchestrator, &station_config, SIGFOX_NULL);
+        if (status != SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS) {
+            fprintf(stderr, "add station %s failed (%d)\n", sim_stations[idx].name, status);
+            goto errors;
+        }
+    }
+    // The whole catalogue is run on each device, the orchestrator selects the stations.
+    for (idx = 0; idx < SIM_NUMBER_OF_JOBS; idx++) {
+        job = &(sim_jobs[idx]);
+        job->test_mode.test_mode_reference = SIM_TEST_MODES[idx % SIM_NUMBER_OF_TEST_MODES].reference;
+        job->estimated_duration_ms = SIM_TEST_MODES[idx % SIM_NUMBER_OF_TEST_MODES].estimated_minutes * SIM_MS_PER_MINUTE;
+        job->capabilities = 0;
+        total_ms += job->estimated_duration_ms;
+        status = SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_submit(&orchestrator, job, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY);
+        if (status != SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS) {
+            fprintf(stderr, "submit job %lu failed (%d)\n", (unsigned long) idx, status);
+            goto errors;
+        }
+    }
+    printf("%lu jobs, %lu ms of estimated work on %lu stations\n", (unsigned long) SIM_NUMBER_OF_JOBS, (unsigned long) total_ms, (unsigned long) SIM_NUMBER_OF_STATIONS);
+    status = SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run(&orchestrator);
+    if (status != SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS) {
+        // The jobs that have not been run are listed below.
+        fprintf(stderr, "run failed (%d)\n", status);
+    }
+    // Jobs.
+    for (idx = 0; idx < SIM_NUMBER_OF_JOBS; idx++) {
+        job = &(sim_jobs[idx]);
+        if (job->station_index == SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY) {
+            printf("device %lu test mode %s: not run\n", (unsigned long) (idx / SIM_NUMBER_OF_TEST_MODES), _get_test_mode(job->test_mode.test_mode_reference)->name);
+            continue;
+        }
+        printf("device %lu test mode %s: %s%s, %lu to %lu ms, progress %u%s\n",
+            (unsigned long) (idx / SIM_NUMBER_OF_TEST_MODES),
+            _get_test_mode(job->test_mode.test_mode_reference)->name,
+            sim_stations[job->station_index].name,
+            (job->stolen == SIGFOX_TRUE) ? " (stolen)" : "",
+            (unsigned long) job->start_ms,
+            (unsigned long) job->end_ms,
+            (unsigned int) job->progress_status.progress,
+            (job->progress_status.status.error != 0) ? " error" : "");
+    }
+    // Stations.
+    for (idx = 0; idx < SIM_NUMBER_OF_STATIONS; idx++) {
+        SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_get_station_report(&orchestrator, (sfx_u8) idx, &station_report);
+        printf("station %s: %u jobs (%u stolen), busy %lu ms, idle after %lu ms, %u pending\n",
+            sim_stations[idx].name,
+            (unsigned int) station_report.number_of_jobs,
+            (unsigned int) station_report.number_of_stolen_jobs,
+            (unsigned long) station_report.busy_ms,
+            (unsigned long) station_report.end_ms,
+            (unsigned int) station_report.number_of_pending_jobs);
+        if (station_report.end_ms > makespan_ms) {
+            makespan_ms = station_report.end_ms;
+        }
+    }
+    printf("makespan %lu ms\n", (unsigned long) makespan_ms);
+    ret = (status == SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS) ? 0 : 1;
+errors:
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_deinit(&orchestrator);
+    return ret;
+}
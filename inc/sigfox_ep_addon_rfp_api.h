@@ -51,6 +51,46 @@
 
 #ifdef SIGFOX_EP_CERTIFICATION
 
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) && !((defined SIGFOX_EP_ASYNCHRONOUS) && (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL))
+#error "SIGFOX_EP_ADDON_RFP_DEADLINE requires SIGFOX_EP_ASYNCHRONOUS and SIGFOX_EP_ADDON_RFP_TIMER_WHEEL"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+#error "SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET requires SIGFOX_EP_ASYNCHRONOUS"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_EARLY_STOP) && !(defined SIGFOX_EP_BIDIRECTIONAL)
+#error "SIGFOX_EP_ADDON_RFP_EARLY_STOP requires SIGFOX_EP_BIDIRECTIONAL"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) && !(defined SIGFOX_EP_REGULATORY)
+#error "SIGFOX_EP_ADDON_RFP_THROUGHPUT requires SIGFOX_EP_REGULATORY"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) && !((defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT))
+#error "SIGFOX_EP_ADDON_RFP_LBT_PROFILER requires SIGFOX_EP_REGULATORY and SIGFOX_EP_SPECTRUM_ACCESS_LBT"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT) && !(defined SIGFOX_EP_PUBLIC_KEY_CAPABLE)
+#error "SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT requires SIGFOX_EP_PUBLIC_KEY_CAPABLE"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_RX_SCAN) && !(defined SIGFOX_EP_BIDIRECTIONAL)
+#error "SIGFOX_EP_ADDON_RFP_RX_SCAN requires SIGFOX_EP_BIDIRECTIONAL"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+#error "SIGFOX_EP_ADDON_RFP_COMMAND requires SIGFOX_EP_ASYNCHRONOUS"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_SOAK) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+#error "SIGFOX_EP_ADDON_RFP_SOAK requires SIGFOX_EP_ASYNCHRONOUS"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE) && !(defined SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE) && !(defined SIGFOX_EP_BIDIRECTIONAL)
+#error "SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE requires SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE or SIGFOX_EP_BIDIRECTIONAL"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+#error "SIGFOX_EP_ADDON_RFP_UPLINK_TIMING requires SIGFOX_EP_ASYNCHRONOUS"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS) && !(defined SIGFOX_EP_BIDIRECTIONAL)
+#error "SIGFOX_EP_ADDON_RFP_SINGLE_PASS requires SIGFOX_EP_BIDIRECTIONAL"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_TELEMETRY) && !(defined SIGFOX_EP_ADDON_RFP_RESULT_STREAM)
+#error "SIGFOX_EP_ADDON_RFP_TELEMETRY requires SIGFOX_EP_ADDON_RFP_RESULT_STREAM"
+#endif
+
 #ifdef SIGFOX_EP_ERROR_CODES
 typedef enum {
     SIGFOX_EP_ADDON_RFP_API_SUCCESS = 0,
@@ -61,6 +101,18 @@ typedef enum {
     SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE,
     SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE_START,
     SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE_PROCESS,
+#ifdef SIGFOX_EP_ADDON_RFP_POSIX
+    SIGFOX_EP_ADDON_RFP_API_ERROR_POSIX,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    SIGFOX_EP_ADDON_RFP_API_ERROR_STEP_TIMEOUT,
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    SIGFOX_EP_ADDON_RFP_API_ERROR_ABORTED,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_TELEMETRY
+    SIGFOX_EP_ADDON_RFP_API_ERROR_TELEMETRY,
+#endif
 } SIGFOX_EP_ADDON_RFP_API_status_t;
 #else
 typedef void SIGFOX_EP_ADDON_RFP_API_status_t;
@@ -69,7 +121,7 @@ typedef void SIGFOX_EP_ADDON_RFP_API_status_t;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
 /*!******************************************************************
  * \brief Sigfox EP ADDON RFP API callback functions.
- * \fn SIGFOX_EP_ADDON_RFP_API_process_cb_t:      Will be called each time a low level IRQ is handled by the addon library. Warning: runs in a IRQ context. Should only change variables state, and call as soon as possible @ref SIGFOX_EP_ADDON_EP_API_process.
+ * \fn SIGFOX_EP_ADDON_RFP_API_process_cb_t:      Will be called when a low level IRQ is handled by the addon library and no process call is already pending. Warning: runs in a IRQ context. Should only change variables state, and call as soon as possible @ref SIGFOX_EP_ADDON_EP_API_process.
  * \fn SIGFOX_EP_ADDON_RFP_API_test_mode_cplt_cb_t:  Will be called when the test mode sequence is done. Optional, could be set to NULL.
  *******************************************************************/
 typedef void (*SIGFOX_EP_ADDON_RFP_API_process_cb_t)(void);
@@ -85,6 +137,386 @@ typedef void (*SIGFOX_EP_ADDON_RFP_API_test_mode_cplt_cb_t)(void);
 typedef void (*SIGFOX_EP_ADDON_RFP_API_downlink_cplt_cb_t)(sfx_u8 *dl_payload, sfx_u8 dl_payload_size, sfx_s16 rssi_dbm);
 #endif
 
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+/*!******************************************************************
+ * \brief Sigfox EP ADDON RFP time source.
+ * \fn SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t:  Returns a free running millisecond counter (wrapping is allowed). Mandatory with the timer wheel, the throughput report, the LBT profiler, the soak statistics, the uplink timing and the test mode E gap, optional for the planner.
+ *******************************************************************/
+typedef sfx_u32 (*SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t)(void);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+/*!******************************************************************
+ * \brief Sigfox EP ADDON RFP execution budget time source.
+ * \fn SIGFOX_EP_ADDON_RFP_API_get_time_us_cb_t:  Returns a free running microsecond counter (wrapping is allowed).
+ *******************************************************************/
+typedef sfx_u32 (*SIGFOX_EP_ADDON_RFP_API_get_time_us_cb_t)(void);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_checkpoint_t
+ * \brief Progress of a long test mode, persisted to resume it after a failure. Fixed size fields so that the structure can be stored as is in NVM.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 test_mode_reference; /*!< SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t of the checkpointed test mode */
+    sfx_u8 state; /*!< Test mode specific state needed to resume the next step */
+    sfx_u16 step; /*!< Number of completed steps (windows of mode B, iterations of mode E, messages of mode J), 0 when there is nothing to resume */
+} SIGFOX_EP_ADDON_RFP_API_checkpoint_t;
+
+/*!******************************************************************
+ * \brief Sigfox EP ADDON RFP checkpoint NVM hooks.
+ * \fn SIGFOX_EP_ADDON_RFP_API_checkpoint_write_cb_t: Store the given checkpoint in NVM.
+ * \fn SIGFOX_EP_ADDON_RFP_API_checkpoint_read_cb_t: Read the last checkpoint from NVM, returns SIGFOX_FALSE if there is none.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_RFP_API_checkpoint_write_cb_t)(const SIGFOX_EP_ADDON_RFP_API_checkpoint_t *checkpoint);
+typedef sfx_bool (*SIGFOX_EP_ADDON_RFP_API_checkpoint_read_cb_t)(SIGFOX_EP_ADDON_RFP_API_checkpoint_t *checkpoint);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+/*!******************************************************************
+ * \brief Sigfox EP ADDON RFP result stream hook.
+ * \fn SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t: Write one TLV record of the result stream (format described in sigfox_ep_addon_rfp_stream.h) to the test station link. The data is only valid during the call.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t)(sfx_u8 *data, sfx_u8 data_size_bytes);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_API_radio_state_t
+ * \brief Radio states used by the energy accounting.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_TX = 0, /*!< Uplink frame transmission */
+    SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_RX, /*!< Downlink listening window */
+    SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_IDLE, /*!< Inter-frame delay and wait before the downlink window */
+    SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_SLEEP, /*!< Remaining time of the test mode windows */
+    SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST
+} SIGFOX_EP_ADDON_RFP_API_radio_state_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_tx_current_t
+ * \brief Supply current of the device when transmitting at a given power.
+ *******************************************************************/
+typedef struct {
+    sfx_s8 tx_power_dbm_eirp;
+    sfx_u32 current_ua;
+} SIGFOX_EP_ADDON_RFP_API_tx_current_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_energy_model_t
+ * \brief Supply current of the device in each radio state. The TX current of the closest power in the table is used.
+ *******************************************************************/
+typedef struct {
+    const SIGFOX_EP_ADDON_RFP_API_tx_current_t *tx_current_table;
+    sfx_u8 tx_current_table_size;
+    sfx_u32 rx_current_ua;
+    sfx_u32 idle_current_ua;
+    sfx_u32 sleep_current_ua;
+} SIGFOX_EP_ADDON_RFP_API_energy_model_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_energy_report_t
+ * \brief Time spent and charge consumed in each radio state since the start of the test mode.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 time_ms[SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST];
+    sfx_u32 charge_uah[SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST];
+    sfx_u32 total_charge_uah;
+} SIGFOX_EP_ADDON_RFP_API_energy_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_API_confidence_t
+ * \brief Confidence level of the test mode E early stop decision, both SPRT error rates are set to 1 - confidence.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_90 = 0,
+    SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_95,
+    SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_99,
+    SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_LAST
+} SIGFOX_EP_ADDON_RFP_API_confidence_t;
+
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_API_verdict_t
+ * \brief Test mode E downlink success ratio compared to the early stop threshold.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_API_VERDICT_PENDING = 0, /*!< Test mode running and no decision yet */
+    SIGFOX_EP_ADDON_RFP_API_VERDICT_PASS, /*!< Success ratio above the threshold */
+    SIGFOX_EP_ADDON_RFP_API_VERDICT_FAIL, /*!< Success ratio below the threshold */
+    SIGFOX_EP_ADDON_RFP_API_VERDICT_UNDECIDED, /*!< All the iterations ran without reaching the confidence level, or the early stop was disabled */
+} SIGFOX_EP_ADDON_RFP_API_verdict_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_early_stop_report_t
+ * \brief Downlink counts and verdict of the running or last test mode E.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_API_verdict_t verdict;
+    sfx_u16 number_of_windows; /*!< Completed listening windows */
+    sfx_u16 number_of_received; /*!< Listening windows in which a downlink frame was received */
+} SIGFOX_EP_ADDON_RFP_API_early_stop_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_throughput_report_t
+ * \brief Messages achieved by the running or last test mode B or J, and delays introduced by the spectrum access controls.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 elapsed_ms; /*!< Time between the first message request and the last message completion */
+    sfx_u16 number_of_messages; /*!< Completed messages, including the blocked ones */
+    sfx_u16 number_of_frames; /*!< Uplink frames actually sent */
+    sfx_u16 number_of_blocked; /*!< Messages reported as network error (no free channel or duty cycle exhausted) */
+    sfx_u16 number_of_deferred; /*!< Messages sent later than their nominal duration */
+    sfx_u32 frames_per_hour; /*!< Achieved frame rate over elapsed_ms */
+    sfx_u32 mean_added_latency_ms; /*!< Mean delay of the sent messages compared to their nominal duration */
+} SIGFOX_EP_ADDON_RFP_API_throughput_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_lbt_stats_t
+ * \brief Carrier sense outcomes of test mode G on one channel with one carrier sense duration.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 tx_frequency_hz; /*!< Profiled channel (0 when chosen by the EP library) */
+    sfx_u32 cs_max_duration_first_frame_ms; /*!< Maximum carrier sense duration of the first frame */
+    sfx_u16 number_of_attempts; /*!< Frames requested */
+    sfx_u16 number_of_clear; /*!< Frames sent after a clear carrier sense */
+    sfx_u16 number_of_busy; /*!< Frames not sent because the channel stayed busy */
+    sfx_u32 cs_time_ms; /*!< Estimated time spent sensing: duration of the messages minus the on-air time of their sent frames and the inter-frame delays between them */
+} SIGFOX_EP_ADDON_RFP_API_lbt_stats_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_lbt_profile_t
+ * \brief Test mode G profiling plan: number_of_messages messages are sent on each channel for each step of the carrier sense duration sweep.
+ *******************************************************************/
+typedef struct {
+    const sfx_u32 *channel_list_hz; /*!< TX frequencies to profile, 0 lets the EP library choose the frequency */
+    sfx_u8 number_of_channels;
+    sfx_u32 cs_max_duration_first_frame_ms; /*!< Carrier sense duration of the first sweep step */
+    sfx_u32 cs_max_duration_step_ms; /*!< Carrier sense duration increment between two sweep steps */
+    sfx_u8 number_of_cs_steps;
+    sfx_u16 number_of_messages; /*!< Messages sent on each channel at each sweep step */
+    SIGFOX_EP_ADDON_RFP_API_lbt_stats_t *stats_table; /*!< Filled by the test mode: number_of_cs_steps * number_of_channels entries, ordered by sweep step then channel */
+} SIGFOX_EP_ADDON_RFP_API_lbt_profile_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t
+ * \brief Downlink frames received by test mode D on one frequency.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 rx_frequency_hz; /*!< Scanned frequency (the downlink central frequency of the RC when 0 in the plan) */
+    sfx_u16 number_of_frames; /*!< Downlink frames received */
+    sfx_u16 number_of_matches; /*!< Received frames matching the test mode D pattern */
+    sfx_s16 rssi_min_dbm; /*!< Lowest RSSI of the received frames (0 when no frame was received) */
+    sfx_s16 rssi_max_dbm; /*!< Highest RSSI of the received frames (0 when no frame was received) */
+    sfx_s32 rssi_sum_dbm; /*!< Sum of the RSSI of the received frames, to be divided by number_of_frames */
+} SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_rx_scan_t
+ * \brief Test mode D scanning plan: the frequencies are listened to one after the other.
+ * \brief A frequency is left when number_of_frames frames have been received on it, or when no frame has been received during dwell_time_ms.
+ *******************************************************************/
+typedef struct {
+    const sfx_u32 *frequency_list_hz; /*!< RX frequencies to scan, 0 for the downlink central frequency of the RC */
+    sfx_u8 number_of_frequencies;
+    sfx_u16 number_of_frames; /*!< Frames to receive on each frequency (0 to stay on the frequency while frames are received) */
+    sfx_u32 dwell_time_ms; /*!< Listening window without frame after which the next frequency is scanned (0 for the window of the certification sequence) */
+    SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t *stats_table; /*!< Filled by the test mode: number_of_frequencies entries, in the order of frequency_list_hz */
+} SIGFOX_EP_ADDON_RFP_API_rx_scan_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+/*!******************************************************************
+ * \def SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS
+ * \brief Number of timing windows kept in the soak report.
+ *******************************************************************/
+#define SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS    8
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_soak_window_t
+ * \brief One timing window of test mode B or J.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 window_index; /*!< Window number since the start of the test mode */
+    sfx_u32 lateness_ms; /*!< Delay between the planned end of the window and the start of the next one */
+    sfx_u32 latency_max_ms; /*!< Longest message completion latency of the window */
+    sfx_u8 number_of_messages;
+    sfx_u8 number_of_errors; /*!< Messages reported as execution or network error */
+} SIGFOX_EP_ADDON_RFP_API_soak_window_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_soak_report_t
+ * \brief Rolling statistics of the running or last test mode B or J.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 number_of_iterations; /*!< Completed passes of the message catalogue */
+    sfx_u32 number_of_windows; /*!< Completed windows */
+    sfx_u32 number_of_messages; /*!< Completed messages */
+    sfx_u32 number_of_execution_errors; /*!< Messages with the execution_error field of the message status */
+    sfx_u32 number_of_network_errors; /*!< Messages with the network_error field of the message status */
+    sfx_u32 latency_min_ms; /*!< Shortest time between a message request and its completion */
+    sfx_u32 latency_max_ms; /*!< Longest time between a message request and its completion */
+    sfx_u32 lateness_max_ms; /*!< Largest lateness of the completed windows */
+    sfx_u8 number_of_recent_windows; /*!< Valid entries of the window table */
+    SIGFOX_EP_ADDON_RFP_API_soak_window_t window[SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS]; /*!< Last completed windows, most recent first */
+} SIGFOX_EP_ADDON_RFP_API_soak_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_voltage_temperature_t
+ * \brief Values returned by MCU_API_get_voltage_temperature() after a message.
+ *******************************************************************/
+typedef struct {
+    sfx_u16 voltage_idle_mv;
+    sfx_u16 voltage_tx_mv; /*!< Supply voltage during the last uplink frame, 0 when the message did not send any */
+    sfx_s16 temperature_tenth_degrees;
+} SIGFOX_EP_ADDON_RFP_API_voltage_temperature_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t
+ * \brief Supply voltage and temperature summary of the running or last test mode.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 number_of_samples; /*!< Messages followed by a successful measurement */
+    sfx_u32 number_of_tx_samples; /*!< Samples of messages which sent at least one uplink frame, the only ones used by the TX voltage fields */
+    sfx_u32 number_of_errors; /*!< Measurements failed by the MCU driver */
+    sfx_u16 voltage_idle_min_mv;
+    sfx_u16 voltage_idle_max_mv;
+    sfx_u16 voltage_tx_min_mv;
+    sfx_u16 voltage_tx_max_mv;
+    sfx_u16 voltage_droop_max_mv; /*!< Largest difference between the idle and TX voltages of a sample */
+    sfx_s16 temperature_min_tenth_degrees;
+    sfx_s16 temperature_max_tenth_degrees;
+    SIGFOX_EP_ADDON_RFP_API_voltage_temperature_t first; /*!< First sample of the test mode */
+    SIGFOX_EP_ADDON_RFP_API_voltage_temperature_t last; /*!< Last sample of the test mode */
+} SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_uplink_timestamps_t
+ * \brief Time source values taken during a message.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 send_ms; /*!< Send call of the message */
+    sfx_u32 uplink_end_ms; /*!< Uplink completion callback, equal to send_ms when it was not called */
+    sfx_u32 message_end_ms; /*!< Message completion callback */
+    sfx_u32 expected_uplink_ms; /*!< On-air time of the frames and inter-frame delays computed from the message parameters */
+    sfx_bool uplink_cplt; /*!< The uplink completion callback was called */
+} SIGFOX_EP_ADDON_RFP_API_uplink_timestamps_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t
+ * \brief Uplink and downlink phase durations of the messages of the running or last test mode.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 number_of_messages; /*!< Completed messages */
+    sfx_u32 number_of_uplinks; /*!< Messages with an uplink completion */
+    sfx_u32 number_of_downlinks; /*!< Completed messages with an uplink completion, the only ones used by the downlink fields */
+    sfx_u32 uplink_min_ms; /*!< Shortest time between the send call and the uplink completion */
+    sfx_u32 uplink_max_ms; /*!< Longest time between the send call and the uplink completion */
+    sfx_s32 uplink_deviation_min_ms; /*!< Smallest difference between the uplink duration and the expected one */
+    sfx_s32 uplink_deviation_max_ms; /*!< Largest difference between the uplink duration and the expected one */
+    sfx_u32 downlink_min_ms; /*!< Shortest time between the uplink completion and the message completion */
+    sfx_u32 downlink_max_ms; /*!< Longest time between the uplink completion and the message completion */
+    sfx_u32 message_min_ms; /*!< Shortest time between the send call and the message completion */
+    sfx_u32 message_max_ms; /*!< Longest time between the send call and the message completion */
+    SIGFOX_EP_ADDON_RFP_API_uplink_timestamps_t last; /*!< Last completed message */
+} SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_single_pass_report_t
+ * \brief Gap between the uplink and the listening window of the running or last test mode E.
+ * \brief With two calls, the gap is the time between the uplink message completion and the listening call.
+ * \brief With a single call, it is the message duration minus the programmed uplink, waiting and listening durations, measured on the iterations without downlink frame.
+ *******************************************************************/
+typedef struct {
+    sfx_bool single_pass; /*!< The iterations were sent as a single call */
+    sfx_u16 number_of_gaps; /*!< Measured iterations */
+    sfx_s32 gap_min_ms;
+    sfx_s32 gap_max_ms;
+    sfx_s32 last_gap_ms;
+} SIGFOX_EP_ADDON_RFP_API_single_pass_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+/*!******************************************************************
+ * \def SIGFOX_EP_ADDON_RFP_API_PUBLIC_KEY_MESSAGES_MAX
+ * \brief Maximum number of messages sent by test mode K (bits, frames with 1 to 12 bytes, empty frame and keep-alive).
+ *******************************************************************/
+#define SIGFOX_EP_ADDON_RFP_API_PUBLIC_KEY_MESSAGES_MAX     16
+
+/*!******************************************************************
+ * \union SIGFOX_EP_ADDON_RFP_API_ul_frames_status_t
+ * \brief Uplink frames sent by one message.
+ *******************************************************************/
+typedef union {
+    struct {
+        sfx_u8 ul_frame_1 : 1;
+        sfx_u8 ul_frame_2 : 1;
+        sfx_u8 ul_frame_3 : 1;
+        sfx_u8 error : 1; /*!< Execution or network error reported by the EP library */
+    } field;
+    sfx_u8 all;
+} SIGFOX_EP_ADDON_RFP_API_ul_frames_status_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_public_key_message_t
+ * \brief One message of test mode K and its result.
+ *******************************************************************/
+typedef struct {
+    sfx_bool control_message; /*!< SIGFOX_TRUE for the keep-alive control message */
+    sfx_u8 message_type; /*!< SIGFOX_application_message_type_t, or SIGFOX_control_message_type_t for a control message */
+    sfx_u8 ul_payload_size_bytes;
+    SIGFOX_EP_ADDON_RFP_API_ul_frames_status_t ul_frames_status; /*!< All zero until the message is completed */
+} SIGFOX_EP_ADDON_RFP_API_public_key_message_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_public_key_report_t
+ * \brief Per message and per frame results of the running or last test mode K.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 number_of_messages; /*!< Messages of the test mode, valid entries of the message table */
+    sfx_u8 number_of_completed; /*!< Messages completed so far, in table order */
+    sfx_u8 number_of_frames_sent;
+    SIGFOX_EP_ADDON_RFP_API_public_key_message_t message[SIGFOX_EP_ADDON_RFP_API_PUBLIC_KEY_MESSAGES_MAX];
+} SIGFOX_EP_ADDON_RFP_API_public_key_report_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+/*!******************************************************************
+ * \def SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE
+ * \brief Number of classes of the NVM write time histogram.
+ *******************************************************************/
+#define SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE    8
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_nvm_report_t
+ * \brief NVM writes and message counter consistency of the running or last test mode L.
+ *******************************************************************/
+typedef struct {
+    sfx_u16 number_of_cycles; /*!< Completed messages */
+    sfx_u16 number_of_counter_errors; /*!< Messages after which the NVM message counter was not the previous one plus one (or 0 on rollover) */
+    sfx_u16 message_counter; /*!< Message counter read in NVM after the last message */
+    sfx_u32 number_of_writes; /*!< Writes reported with SIGFOX_EP_ADDON_RFP_API_add_nvm_write() */
+    sfx_u32 write_time_min_us;
+    sfx_u32 write_time_max_us;
+    sfx_u32 write_time_mean_us;
+    sfx_u32 write_time_histogram[SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE]; /*!< Writes below 100 us, 500 us, 1 ms, 5 ms, 10 ms, 50 ms, 100 ms and above */
+} SIGFOX_EP_ADDON_RFP_API_nvm_report_t;
+#endif
+
 /*!******************************************************************
  * \enum SIGFOX_EP_ADDON_RFP_API_config_t
  * \briefS Sigfox EP ADDON RFP configuration structure.
@@ -97,6 +529,26 @@ typedef struct {
 #ifndef SIGFOX_EP_MESSAGE_COUNTER_ROLLOVER
     SIGFOX_message_counter_rollover_t message_counter_rollover;
 #endif
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    sfx_u32 step_deadline_margin_ms; /*!< Added to the on-air time of each message to get its deadline (0 to disable the supervision) */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    SIGFOX_EP_ADDON_RFP_API_get_time_us_cb_t get_time_us;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    SIGFOX_EP_ADDON_RFP_API_checkpoint_write_cb_t checkpoint_write;
+    SIGFOX_EP_ADDON_RFP_API_checkpoint_read_cb_t checkpoint_read;
+    sfx_u16 checkpoint_period; /*!< Number of completed steps between two checkpoints (0 to disable the checkpoints) */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t stream_write; /*!< Result stream of the test modes (SIGFOX_NULL to disable the stream) */
+#endif
 } SIGFOX_EP_ADDON_RFP_API_config_t;
 
 /*!******************************************************************
@@ -140,6 +592,31 @@ typedef struct {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     SIGFOX_EP_ADDON_RFP_API_test_mode_cplt_cb_t test_mode_cplt_cb;
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    sfx_u8 early_stop_threshold_percent; /*!< Test mode E stops as soon as the downlink success ratio is known to be above or below this threshold (0 to run all the iterations) */
+    SIGFOX_EP_ADDON_RFP_API_confidence_t early_stop_confidence;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    sfx_bool regulatory_controls; /*!< Test modes B and J keep the FH, LBT and LDC controls enabled, and blocked messages do not abort the test mode */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    const SIGFOX_EP_ADDON_RFP_API_lbt_profile_t *lbt_profile; /*!< Test mode G profiles the carrier sense with this plan (NULL to run the certification sequence) */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    sfx_u16 nvm_stress_cycles; /*!< Test mode L sends this number of single frame messages back to back (0 to run the certification sequence) */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    const SIGFOX_EP_ADDON_RFP_API_rx_scan_t *rx_scan; /*!< Test mode D scans the RX frequencies of this plan (NULL to run the certification sequence) */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    sfx_bool soak; /*!< Test modes B and J repeat their message catalogue until the test mode is aborted, and errors are counted instead of ending the test mode */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+    sfx_bool voltage_temperature; /*!< The supply voltage and the temperature are sampled after each message of the test mode */
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    sfx_bool single_pass; /*!< Test mode E sends the uplink and opens the listening window with a single call and shortened waiting time */
+#endif
 } SIGFOX_EP_ADDON_RFP_API_test_mode_t;
 
 /*!******************************************************************
@@ -153,6 +630,29 @@ typedef struct {
     sfx_u8 progress :7;
 } SIGFOX_EP_ADDON_RFP_API_progress_status_t;
 
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t
+ * \brief Expected duration and number of messages and frames of a test mode.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 duration_ms;
+    sfx_u16 number_of_messages;
+    sfx_u16 number_of_frames;
+    sfx_bool open_ended; /*!< The test mode continues as long as downlink frames are received: the plan gives the minimum */
+} SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_API_test_mode_timing_t
+ * \brief Timing of the running or last test mode.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 planned_ms;
+    sfx_u32 elapsed_ms;
+    sfx_u32 remaining_ms; /*!< 0 when the test mode is late regarding the plan */
+} SIGFOX_EP_ADDON_RFP_API_test_mode_timing_t;
+#endif
+
 /*** SIGFOX EP API functions ***/
 
 /*!******************************************************************
@@ -182,6 +682,28 @@ SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_close(void);
  * \retval      Function execution status.
  *******************************************************************/
 SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process(void);
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_EP_ADDON_RFP_API_is_process_pending(void)
+ * \brief Indicate if events are waiting for the process function. When SIGFOX_FALSE is returned after a process call, the application can go to sleep until the next process callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the process function has to be called, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_EP_ADDON_RFP_API_is_process_pending(void);
+
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process_budget(sfx_u32 max_us, sfx_bool *yielded)
+ * \brief Process function of the RFP addon with an execution budget, to be called instead of SIGFOX_EP_ADDON_RFP_API_process().
+ * \brief The events are handled one pass after the other until none is left or the budget is exhausted. A pass is never interrupted, so the budget can be exceeded by the duration of one pass.
+ * \brief When the function yields, the process callback is triggered again.
+ * \param[in]   max_us: Execution budget in microseconds.
+ * \param[out]  yielded: Set to SIGFOX_TRUE if events are left when the function returns.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process_budget(sfx_u32 max_us, sfx_bool *yielded);
+#endif
 #endif
 
 /*!******************************************************************
@@ -193,6 +715,31 @@ SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process(void);
  *******************************************************************/
 SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode);
 
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_resume_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode)
+ * \brief Execute a test mode from the last checkpoint read with the checkpoint_read hook.
+ * \brief Only the modes B, E and J can be resumed, the test mode starts from the beginning if the checkpoint does not match the given test mode.
+ * \param[in]   test_mode: Pointer to the test_mode data.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_resume_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode);
+#endif
+
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_abort_test_mode(void)
+ * \brief Abort the running test mode. The addon timers are stopped and the test mode completion callback is called with an error progress status.
+ * \brief A message already started by the EP library is not interrupted: its completion is not given to the test mode, and the completion callback is only called once it is received.
+ * \brief A new test mode is rejected until the completion callback has been called.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_abort_test_mode(void);
+#endif
+
 /*!******************************************************************
  * \fn SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_progress_status(void)
  * \brief Get the current message status.
@@ -202,6 +749,134 @@ SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADD
  *******************************************************************/
 SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_progress_status(void);
 
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_plan_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of a test mode without executing it.
+ * \param[in]   test_mode: Pointer to the test mode parameters.
+ * \param[out]  plan: Pointer to the plan to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_plan_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_timing(SIGFOX_EP_ADDON_RFP_API_test_mode_timing_t *timing)
+ * \brief Get the elapsed and remaining time of the running or last test mode.
+ * \param[in]   none
+ * \param[out]  timing: Pointer to the timing to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_timing(SIGFOX_EP_ADDON_RFP_API_test_mode_timing_t *timing);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_energy_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report)
+ * \brief Get the energy accounting of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  energy_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_energy_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_early_stop_report(SIGFOX_EP_ADDON_RFP_API_early_stop_report_t *early_stop_report)
+ * \brief Get the downlink counts and the early stop verdict of the running or last test mode E.
+ * \param[in]   none
+ * \param[out]  early_stop_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_early_stop_report(SIGFOX_EP_ADDON_RFP_API_early_stop_report_t *early_stop_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_throughput_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report)
+ * \brief Get the achieved frame rate and the added latency of the running or last test mode B or J.
+ * \param[in]   none
+ * \param[out]  throughput_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_throughput_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_public_key_report(SIGFOX_EP_ADDON_RFP_API_public_key_report_t *public_key_report)
+ * \brief Get the messages sent with the public key by the running or last test mode K and the result of each frame.
+ * \param[in]   none
+ * \param[out]  public_key_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_public_key_report(SIGFOX_EP_ADDON_RFP_API_public_key_report_t *public_key_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_API_add_nvm_write(sfx_u32 write_time_us)
+ * \brief Report one NVM write. To be called by the MCU_API_set_nvm() implementation with its own measured duration.
+ * \param[in]   write_time_us: Duration of the write.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_API_add_nvm_write(sfx_u32 write_time_us);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_nvm_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report)
+ * \brief Get the NVM write statistics and the message counter consistency of the running or last test mode L.
+ * \param[in]   none
+ * \param[out]  nvm_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_nvm_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_soak_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report)
+ * \brief Get the rolling statistics of the running or last test mode B or J, without stopping it.
+ * \param[in]   none
+ * \param[out]  soak_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_soak_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_voltage_temperature_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report)
+ * \brief Get the supply voltage and temperature summary of the running or last test mode.
+ * \param[in]   none
+ * \param[out]  voltage_temperature_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_voltage_temperature_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_uplink_timing_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report)
+ * \brief Get the uplink and downlink phase durations of the running or last test mode.
+ * \param[in]   none
+ * \param[out]  uplink_timing_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_uplink_timing_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_single_pass_report(SIGFOX_EP_ADDON_RFP_API_single_pass_report_t *single_pass_report)
+ * \brief Get the gap between the uplink and the listening window of the running or last test mode E.
+ * \param[in]   none
+ * \param[out]  single_pass_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_single_pass_report(SIGFOX_EP_ADDON_RFP_API_single_pass_report_t *single_pass_report);
+#endif
+
 #ifdef SIGFOX_EP_VERBOSE
 /*!******************************************************************
  * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_version(sfx_u8 **version, sfx_u8 *version_size_char)
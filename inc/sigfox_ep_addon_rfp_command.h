@@ -0,0 +1,160 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_command.h
+ * \brief   Sigfox addon RF & Protocol command front-end
+ * \details This file drives the asynchronous addon from a binary command protocol received on any byte transport.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_EP_ADDON_RFP_COMMAND_H__
+#define __SIGFOX_EP_ADDON_RFP_COMMAND_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_COMMAND)
+
+/*** SIGFOX EP ADDON RFP COMMAND macros ***/
+
+#ifndef SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES
+#define SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES        32
+#endif
+
+/*** SIGFOX EP ADDON RFP COMMAND protocol ***/
+
+// Commands and replies use the framing of the result stream: identifier (1 byte), length of the value (1 byte) and value.
+// The host waits for the reply of a command before sending the next one. A command with an unexpected length is skipped using its length.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES           2
+#define SIGFOX_EP_ADDON_RFP_COMMAND_VALUE_SIZE_MAX_BYTES        3
+// Open the addon: RC index in the table of the configuration, message counter rollover (ignored when fixed at compile time).
+#define SIGFOX_EP_ADDON_RFP_COMMAND_OPEN                        0x01
+#define SIGFOX_EP_ADDON_RFP_COMMAND_OPEN_SIZE_BYTES             2
+// Close the addon.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_CLOSE                       0x02
+#define SIGFOX_EP_ADDON_RFP_COMMAND_CLOSE_SIZE_BYTES            0
+// Start a test mode: test mode reference, uplink bit rate and TX power in dBm (signed), both ignored when fixed at compile time.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE                   0x03
+#define SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE_SIZE_BYTES        3
+// Abort the running test mode. The completion event is sent once the message in progress in the EP library is completed.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_ABORT                       0x04
+#define SIGFOX_EP_ADDON_RFP_COMMAND_ABORT_SIZE_BYTES            0
+// Read the progress: reply value is status, front-end state, progress status.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_GET_PROGRESS                0x05
+#define SIGFOX_EP_ADDON_RFP_COMMAND_GET_PROGRESS_SIZE_BYTES     0
+// Read the result of the last test mode: reply value is status, test mode reference, progress status.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_GET_RESULT                  0x06
+#define SIGFOX_EP_ADDON_RFP_COMMAND_GET_RESULT_SIZE_BYTES       0
+// Reply identifier is the command identifier with this bit set. The first byte of the value is the status.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_REPLY                       0x80
+#define SIGFOX_EP_ADDON_RFP_COMMAND_REPLY_SIZE_MAX_BYTES        3
+// Unsolicited event sent when a test mode is completed or aborted: test mode reference, progress status.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_TEST_MODE_CPLT        0xC0
+#define SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_TEST_MODE_CPLT_SIZE_BYTES 2
+// Unsolicited event sent when received bytes have been lost: the pending command must be sent again.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_RX_OVERFLOW           0xC1
+#define SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_RX_OVERFLOW_SIZE_BYTES 0
+
+/*** SIGFOX EP ADDON RFP COMMAND fields ***/
+
+// Reply status: SIGFOX_EP_ADDON_RFP_API_status_t value of the addon call, or one of the front-end errors below.
+// When the error codes are disabled, the addon errors are not reported in the reply status.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS              0x00
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_COMMAND        0xF0
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_LENGTH         0xF1
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_PARAMETER      0xF2
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_STATE          0xF3
+// Front-end state.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATE_CLOSE                 0x00
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATE_READY                 0x01
+#define SIGFOX_EP_ADDON_RFP_COMMAND_STATE_RUNNING               0x02
+// Progress status: error bit and progress in percent.
+#define SIGFOX_EP_ADDON_RFP_COMMAND_PROGRESS_ERROR              0x80
+#define SIGFOX_EP_ADDON_RFP_COMMAND_PROGRESS_MASK               0x7F
+
+/*** SIGFOX EP ADDON RFP COMMAND structures ***/
+
+/*!******************************************************************
+ * \brief Sigfox EP ADDON RFP COMMAND callback functions.
+ * \fn SIGFOX_EP_ADDON_RFP_COMMAND_reply_cb_t: Will be called in the process context to send a complete reply or event frame on the transport. Must not block.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_RFP_COMMAND_reply_cb_t)(sfx_u8 *data, sfx_u8 data_size_bytes);
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_COMMAND_config_t
+ * \brief Sigfox EP ADDON RFP COMMAND configuration structure.
+ *******************************************************************/
+typedef struct {
+    const SIGFOX_rc_t * const *rc_table; /*!< Radio configurations selected by the open command */
+    sfx_u8 number_of_rc;
+    const SIGFOX_EP_ADDON_RFP_API_config_t *addon_config; /*!< Used by the open command: the RC, message counter rollover and process callback are replaced */
+    const SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode; /*!< Used by the test mode command: the reference, bit rate, TX power and completion callback are replaced */
+    SIGFOX_EP_ADDON_RFP_API_process_cb_t process_cb; /*!< Called when a command is received or an addon event is raised. Warning: runs in a IRQ context */
+    SIGFOX_EP_ADDON_RFP_COMMAND_reply_cb_t reply;
+} SIGFOX_EP_ADDON_RFP_COMMAND_config_t;
+
+/*** SIGFOX EP ADDON RFP COMMAND functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_init(const SIGFOX_EP_ADDON_RFP_COMMAND_config_t *config)
+ * \brief Initialize the command front-end. The addon is opened later by the open command.
+ * \param[in]   config: Pointer to the front-end configuration, which must remain valid while the front-end is used.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_init(const SIGFOX_EP_ADDON_RFP_COMMAND_config_t *config);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_COMMAND_receive(sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Give the bytes received on the transport to the front-end. Can be called from the reception IRQ: the bytes are only buffered and the process callback is called.
+ * \param[in]   data: Received bytes.
+ * \param[in]   data_size_bytes: Number of received bytes.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_COMMAND_receive(sfx_u8 *data, sfx_u8 data_size_bytes);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_process(void)
+ * \brief Process function of the front-end, to call when the process callback is triggered instead of the addon process function.
+ * \brief The addon events are handled first, then the received commands are executed and the replies are sent. No call blocks until a test mode is completed.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Status of the addon process function.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_process(void);
+
+#endif
+#endif /* __SIGFOX_EP_ADDON_RFP_COMMAND_H__ */
@@ -0,0 +1,140 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_posix.h
+ * \brief   Sigfox addon RF & Protocol POSIX port
+ * \details This file runs the asynchronous addon in a dedicated worker thread on POSIX hosts.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __SIGFOX_EP_ADDON_RFP_POSIX_H__
+#define __SIGFOX_EP_ADDON_RFP_POSIX_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_POSIX)
+
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+#error "SIGFOX_EP_ADDON_RFP_POSIX requires SIGFOX_EP_ASYNCHRONOUS"
+#endif
+// The timer wheel turns the MCU timer expirations into addon events, so that the test modes callbacks are all executed by the worker thread.
+#ifndef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+#error "SIGFOX_EP_ADDON_RFP_POSIX requires SIGFOX_EP_ADDON_RFP_TIMER_WHEEL"
+#endif
+
+/*** SIGFOX EP ADDON RFP POSIX structures ***/
+
+/*!******************************************************************
+ * \brief Sigfox EP ADDON RFP POSIX callback functions.
+ * \fn SIGFOX_EP_ADDON_RFP_POSIX_post_cb_t: Will be called from the worker thread to execute a user callback in another thread. Optional, could be set to NULL to execute the callbacks in the worker thread.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_RFP_POSIX_post_cb_t)(SIGFOX_EP_ADDON_RFP_API_test_mode_cplt_cb_t callback);
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_POSIX_config_t
+ * \brief Sigfox EP ADDON RFP POSIX configuration structure.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_API_config_t *addon_config;
+    SIGFOX_EP_ADDON_RFP_POSIX_post_cb_t post_cb;
+} SIGFOX_EP_ADDON_RFP_POSIX_config_t;
+
+/*** SIGFOX EP ADDON RFP POSIX functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_open(SIGFOX_EP_ADDON_RFP_POSIX_config_t *config)
+ * \brief Open the RFP addon and start the worker thread. The process callback of the addon configuration is replaced by the worker thread wake-up.
+ * \param[in]   config: Pointer to the port configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_open(SIGFOX_EP_ADDON_RFP_POSIX_config_t *config);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_close(void)
+ * \brief Stop the worker thread and close the RFP addon.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_close(void);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode)
+ * \brief Start a test mode from any thread. The completion callback is executed through the post callback of the port configuration.
+ * \param[in]   test_mode: Pointer to the test_mode data.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_lock(void)
+ * \brief Take the addon lock. Must surround any other addon API call made outside of the worker thread.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_lock(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_unlock(void)
+ * \brief Release the addon lock.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_unlock(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_enter_critical(void)
+ * \brief Protect the addon event flags against concurrent updates (used by the addon itself).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_enter_critical(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_exit_critical(void)
+ * \brief Release the addon event flags protection (used by the addon itself).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_exit_critical(void);
+
+#endif
+#endif /* __SIGFOX_EP_ADDON_RFP_POSIX_H__ */
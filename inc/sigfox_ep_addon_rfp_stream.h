@@ -0,0 +1,87 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_stream.h
+ * \brief   Sigfox addon RF & Protocol result stream format
+ * \details This file describes the TLV records written by the addon through the stream_write hook.
+ *          It has no dependency on the EP library so that it can be shared with the host decoder.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_EP_ADDON_RFP_STREAM_H__
+#define __SIGFOX_EP_ADDON_RFP_STREAM_H__
+
+/*** SIGFOX EP ADDON RFP STREAM format ***/
+
+// Each record is made of a tag (1 byte), the length of the value (1 byte) and the value.
+// Multi-byte fields are big endian. A decoder skips the records with an unknown tag using their length,
+// and ignores the trailing bytes of a known record longer than expected, so that records can be extended.
+#define SIGFOX_EP_ADDON_RFP_STREAM_VERSION                      1
+#define SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES            2
+#define SIGFOX_EP_ADDON_RFP_STREAM_RECORD_SIZE_MAX_BYTES        (SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES + SIGFOX_EP_ADDON_RFP_STREAM_DOWNLINK_SIZE_BYTES)
+
+/*** SIGFOX EP ADDON RFP STREAM records ***/
+
+// Test mode start: stream version, test mode reference.
+#define SIGFOX_EP_ADDON_RFP_STREAM_TAG_START                    0x01
+#define SIGFOX_EP_ADDON_RFP_STREAM_START_SIZE_BYTES             2
+// Message completion: message status bits.
+#define SIGFOX_EP_ADDON_RFP_STREAM_TAG_MESSAGE                  0x02
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_SIZE_BYTES           1
+// Downlink frame: RSSI in dBm (signed), payload.
+#define SIGFOX_EP_ADDON_RFP_STREAM_TAG_DOWNLINK                 0x03
+#define SIGFOX_EP_ADDON_RFP_STREAM_DOWNLINK_SIZE_BYTES          10
+// Test mode end: progress status, addon status code.
+#define SIGFOX_EP_ADDON_RFP_STREAM_TAG_END                      0x04
+#define SIGFOX_EP_ADDON_RFP_STREAM_END_SIZE_BYTES               2
+// Voltage and temperature after a message: idle voltage in mV, TX voltage in mV (0 without uplink frame), temperature in tenth of degrees (signed).
+#define SIGFOX_EP_ADDON_RFP_STREAM_TAG_VOLTAGE_TEMPERATURE      0x05
+#define SIGFOX_EP_ADDON_RFP_STREAM_VOLTAGE_TEMPERATURE_SIZE_BYTES   6
+
+/*** SIGFOX EP ADDON RFP STREAM fields ***/
+
+// Message status bits.
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_UL_FRAME_1           0x01
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_UL_FRAME_2           0x02
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_UL_FRAME_3           0x04
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_DL_FRAME             0x08
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_DL_CONF_FRAME        0x10
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_NETWORK_ERROR        0x20
+#define SIGFOX_EP_ADDON_RFP_STREAM_MESSAGE_EXECUTION_ERROR      0x40
+// Progress status: error bit and progress in percent.
+#define SIGFOX_EP_ADDON_RFP_STREAM_END_ERROR                    0x80
+#define SIGFOX_EP_ADDON_RFP_STREAM_END_PROGRESS_MASK            0x7F
+// Addon status code: SIGFOX_EP_ADDON_RFP_API_status_t value, or a generic error when the error codes are disabled.
+#define SIGFOX_EP_ADDON_RFP_STREAM_STATUS_SUCCESS               0x00
+#define SIGFOX_EP_ADDON_RFP_STREAM_STATUS_ERROR                 0xFF
+
+#endif /* __SIGFOX_EP_ADDON_RFP_STREAM_H__ */
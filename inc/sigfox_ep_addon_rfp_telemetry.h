@@ -0,0 +1,90 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_telemetry.h
+ * \brief   Sigfox addon RF & Protocol telemetry segment format
+ * \details This file describes the shared memory segment in which the host build of the addon publishes its
+ *          progress status and the records of the result stream. It has no dependency on the EP library so that
+ *          it can be shared with the host aggregators.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_EP_ADDON_RFP_TELEMETRY_H__
+#define __SIGFOX_EP_ADDON_RFP_TELEMETRY_H__
+
+#include <stdint.h>
+#include "sigfox_ep_addon_rfp_stream.h"
+
+/*** SIGFOX EP ADDON RFP TELEMETRY format ***/
+
+// The segment is made of the header followed by the ring of the result stream records (TLV format described in
+// sigfox_ep_addon_rfp_stream.h). Fields are in the host byte order since the segment is only shared between the
+// processes of a single machine.
+// The header is protected by a sequence lock: the writer makes the sequence odd, updates the header and the ring,
+// then makes the sequence even again. A reader copies the header between two reads of an even and unchanged
+// sequence, and retries otherwise. The writer is never blocked by the readers.
+// The write offset counts all the bytes written since the segment creation and is always at a record boundary.
+// It is updated before the ring bytes, so that a reader can check that its copy of the ring was not overwritten.
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_MAGIC                     0x54504652 /* "RFPT" */
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_VERSION                   1
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES         64
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_RING_SIZE_MIN_BYTES       256
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_RING_SIZE_DEFAULT_BYTES   4096
+
+/*** SIGFOX EP ADDON RFP TELEMETRY fields ***/
+
+// Segment state bits.
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_RUNNING             0x01 /* A test mode is running */
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_CLOSED              0x02 /* The writer closed the segment, a new one could be created with the same name */
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t
+ * \brief Telemetry segment header.
+ *******************************************************************/
+typedef struct {
+    uint32_t magic; /*!< Written last when the segment is created */
+    uint16_t version;
+    uint16_t header_size_bytes;
+    uint32_t ring_size_bytes;
+    uint32_t writer_pid; /*!< Allows the aggregator to detect a station which died without closing the segment */
+    uint32_t sequence; /*!< Odd while the writer updates the segment */
+    uint8_t state; /*!< SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_xxx bits */
+    uint8_t test_mode_reference; /*!< SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t value of the current or last test mode */
+    uint8_t progress; /*!< SIGFOX_EP_ADDON_RFP_STREAM_END_ERROR bit and progress in percent */
+    uint8_t status; /*!< Addon status code of the last end record */
+    uint32_t number_of_test_modes;
+    uint32_t number_of_records;
+    uint64_t write_offset;
+    uint8_t reserved[SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES - 40];
+} SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t;
+
+#endif /* __SIGFOX_EP_ADDON_RFP_TELEMETRY_H__ */
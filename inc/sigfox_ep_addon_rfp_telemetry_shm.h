@@ -0,0 +1,97 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_telemetry_shm.h
+ * \brief   Sigfox addon RF & Protocol telemetry segment writer
+ * \details This file publishes the progress status and the result stream records of the addon in a POSIX shared
+ *          memory segment (format described in sigfox_ep_addon_rfp_telemetry.h).
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_EP_ADDON_RFP_TELEMETRY_SHM_H__
+#define __SIGFOX_EP_ADDON_RFP_TELEMETRY_SHM_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "sigfox_ep_addon_rfp_telemetry.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_TELEMETRY)
+
+/*** SIGFOX EP ADDON RFP TELEMETRY structures ***/
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_TELEMETRY_config_t
+ * \brief Sigfox EP ADDON RFP TELEMETRY configuration structure.
+ *******************************************************************/
+typedef struct {
+    const sfx_char *name; /*!< POSIX shared memory object name (starting with '/'), one per station */
+    sfx_u32 ring_size_bytes; /*!< Size of the records ring (0 for SIGFOX_EP_ADDON_RFP_TELEMETRY_RING_SIZE_DEFAULT_BYTES) */
+    SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t stream_write; /*!< Records are also forwarded to the test station link (SIGFOX_NULL to disable) */
+} SIGFOX_EP_ADDON_RFP_TELEMETRY_config_t;
+
+/*** SIGFOX EP ADDON RFP TELEMETRY functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_config_t *config)
+ * \brief Create and map the telemetry segment. A segment left with the same name by a previous station is replaced,
+ * \brief the aggregators which still map it see it as closed.
+ * \param[in]   config: Pointer to the telemetry configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_config_t *config);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_close(void)
+ * \brief Mark the telemetry segment as closed, unmap and remove it. The aggregators keep their mapping until they close it.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_close(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_TELEMETRY_stream_write(sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Result stream hook to be given as stream_write of the addon configuration. Each record is copied in the ring
+ * \brief and the progress status of the header is updated, without any system call.
+ * \param[in]   data: Record bytes.
+ * \param[in]   data_size_bytes: Record size.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_TELEMETRY_stream_write(sfx_u8 *data, sfx_u8 data_size_bytes);
+
+#endif
+#endif /* __SIGFOX_EP_ADDON_RFP_TELEMETRY_SHM_H__ */
@@ -0,0 +1,267 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_common.h
+ * \brief   Sigfox addon RF & Protocol common helpers
+ * \details This file provides the helpers shared by the RF & Protocol test modes.
+ *          Test modes send their messages and drive the addon timer through this
+ *          module, so that optional features can observe every radio activity.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __SIGFOX_RFP_COMMON_H__
+#define __SIGFOX_RFP_COMMON_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "manuf/mcu_api.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_api_test.h"
+#include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+
+#ifdef SIGFOX_EP_CERTIFICATION
+
+#if !(defined SIGFOX_EP_SINGLE_FRAME) || !(defined SIGFOX_EP_UL_BIT_RATE_BPS) || !(defined SIGFOX_EP_TX_POWER_DBM_EIRP) || (defined SIGFOX_EP_PUBLIC_KEY_CAPABLE)
+#define SIGFOX_RFP_COMMON_PARAMETERS
+#endif
+// The message in progress is tracked when the test modes can be aborted.
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+#define SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+#endif
+
+#define SIGFOX_RFP_COMMON_KEEP_ALIVE_PAYLOAD_BYTES  7
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+// Downlink timings used by the EP library when the test parameters are 0.
+#define SIGFOX_RFP_COMMON_DEFAULT_DL_T_W_MS         20000
+#define SIGFOX_RFP_COMMON_DEFAULT_DL_T_RX_MS        25000
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(number_of_frames)
+ * \brief Number of frames of the messages sent by a test mode, according to the single frame flag.
+ *******************************************************************/
+#ifdef SIGFOX_EP_SINGLE_FRAME
+#define SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(number_of_frames) 1
+#else
+#define SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(number_of_frames) (number_of_frames)
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(default_size)
+ * \brief Payload size of the message sent by a test mode, according to the message types and payload size selected by the flags.
+ *******************************************************************/
+#ifndef SIGFOX_EP_APPLICATION_MESSAGES
+#define SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(default_size) SIGFOX_RFP_COMMON_KEEP_ALIVE_PAYLOAD_BYTES
+#elif (defined SIGFOX_EP_UL_PAYLOAD_SIZE)
+#define SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(default_size) SIGFOX_EP_UL_PAYLOAD_SIZE
+#else
+#define SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(default_size) (default_size)
+#endif
+
+/*!******************************************************************
+ * \struct SIGFOX_RFP_COMMON_airtime_t
+ * \brief Durations of the radio activities of one message.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 tx_ms;
+    sfx_u32 ifu_ms;
+    sfx_u32 t_w_ms;
+    sfx_u32 rx_ms;
+    sfx_s8 tx_power_dbm_eirp;
+} SIGFOX_RFP_COMMON_airtime_t;
+
+/*!******************************************************************
+ * \brief Test mode timer completion callback.
+ *******************************************************************/
+typedef void (*SIGFOX_RFP_COMMON_timer_cplt_cb_t)(void);
+
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+/*!******************************************************************
+ * \brief Step deadline expiration callback.
+ *******************************************************************/
+typedef void (*SIGFOX_RFP_COMMON_deadline_cb_t)(void);
+#endif
+
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+/*!******************************************************************
+ * \brief Completion callback of a dropped message.
+ *******************************************************************/
+typedef void (*SIGFOX_RFP_COMMON_message_dropped_cb_t)(void);
+#endif
+
+/*** SIGFOX RFP COMMON functions ***/
+
+/*!******************************************************************
+ * \fn sfx_u32 SIGFOX_RFP_COMMON_get_ul_frame_duration_ms(sfx_u8 ul_payload_size_bytes, sfx_u16 ul_bit_rate_bps)
+ * \brief Compute the on-air duration of a single uplink frame.
+ * \param[in]   ul_payload_size_bytes: User payload size (0 for bit and empty frames).
+ * \param[in]   ul_bit_rate_bps: Uplink bit rate in bps.
+ * \param[out]  none
+ * \retval      Frame duration in ms.
+ *******************************************************************/
+sfx_u32 SIGFOX_RFP_COMMON_get_ul_frame_duration_ms(sfx_u8 ul_payload_size_bytes, sfx_u16 ul_bit_rate_bps);
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn sfx_u32 SIGFOX_RFP_COMMON_get_ul_message_duration_ms(const SIGFOX_RFP_test_mode_t *rfp_test_mode, sfx_u8 ul_payload_size_bytes, sfx_u8 number_of_frames, sfx_u32 t_ifu_ms)
+ * \brief Compute the uplink duration of a message sent by a test mode, including the inter-frame delays.
+ * \param[in]   rfp_test_mode: Test mode parameters.
+ * \param[in]   ul_payload_size_bytes: User payload size (0 for bit and empty frames).
+ * \param[in]   number_of_frames: Number of frames requested by the test mode (ignored in single frame mode).
+ * \param[in]   t_ifu_ms: Inter-frame delay requested by the test mode (ignored if fixed by the flags).
+ * \param[out]  none
+ * \retval      Message uplink duration in ms.
+ *******************************************************************/
+sfx_u32 SIGFOX_RFP_COMMON_get_ul_message_duration_ms(const SIGFOX_RFP_test_mode_t *rfp_test_mode, sfx_u8 ul_payload_size_bytes, sfx_u8 number_of_frames, sfx_u32 t_ifu_ms);
+#endif
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_get_application_message_airtime(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Compute the radio activities durations of an application message sent with the test API.
+ * \param[in]   application_message: Message to analyze.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  airtime: Durations of the message radio activities.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_get_application_message_airtime(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime);
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_get_control_message_airtime(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Compute the radio activities durations of a control message sent with the test API.
+ * \param[in]   control_message: Message to analyze.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  airtime: Durations of the message radio activities.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_get_control_message_airtime(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime);
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_application_message(SIGFOX_EP_API_application_message_t *application_message, SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Send an application message with the test API.
+ * \param[in]   application_message: Message to send.
+ * \param[in]   test_param: Test parameters.
+ * \param[out]  none
+ * \retval      EP library status.
+ *******************************************************************/
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_application_message(SIGFOX_EP_API_application_message_t *application_message, SIGFOX_EP_API_TEST_parameters_t *test_param);
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_control_message(SIGFOX_EP_API_control_message_t *control_message, SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Send a control message with the test API.
+ * \param[in]   control_message: Message to send.
+ * \param[in]   test_param: Test parameters.
+ * \param[out]  none
+ * \retval      EP library status.
+ *******************************************************************/
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_control_message(SIGFOX_EP_API_control_message_t *control_message, SIGFOX_EP_API_TEST_parameters_t *test_param);
+#endif
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_COMMON_timer_start(MCU_API_timer_t *timer)
+ * \brief Start the addon timer.
+ * \param[in]   timer: Timer parameters.
+ * \param[out]  none
+ * \retval      MCU driver status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_COMMON_timer_start(MCU_API_timer_t *timer);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_COMMON_timer_stop(void)
+ * \brief Stop the addon timer.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      MCU driver status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_COMMON_timer_stop(void);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_COMMON_timer_wait_cplt(SIGFOX_RFP_COMMON_timer_cplt_cb_t timer_cplt_cb)
+ * \brief Wait for the addon timer expiration. In blocking mode, the function waits for the timer and calls the given completion callback.
+ * \brief In asynchronous mode, the callback is called by the timer itself and the function returns immediately.
+ * \param[in]   timer_cplt_cb: Timer completion callback of the test mode.
+ * \param[out]  none
+ * \retval      MCU driver status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_COMMON_timer_wait_cplt(SIGFOX_RFP_COMMON_timer_cplt_cb_t timer_cplt_cb);
+
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_set_step_deadline(sfx_u32 margin_ms, SIGFOX_RFP_COMMON_deadline_cb_t deadline_cb)
+ * \brief Configure the supervision of the messages sent by the test modes.
+ * \brief Each message has to be completed within its on-air time plus the given margin, otherwise the deadline callback is called and the message completion is discarded.
+ * \param[in]   margin_ms: Margin added to the on-air time of each message (0 to disable the supervision).
+ * \param[in]   deadline_cb: Called when a message is not completed in time.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_set_step_deadline(sfx_u32 margin_ms, SIGFOX_RFP_COMMON_deadline_cb_t deadline_cb);
+#endif
+
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_reset_message(void)
+ * \brief Forget the message in progress (EP library opened again).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_reset_message(void);
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_RFP_COMMON_drop_message(SIGFOX_RFP_COMMON_message_dropped_cb_t message_dropped_cb)
+ * \brief Discard the completion of the message in progress, so that it does not reach the aborted test mode.
+ * \param[in]   message_dropped_cb: Called instead of the test mode callback when the message is completed.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if a message is in progress in the EP library, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_RFP_COMMON_drop_message(SIGFOX_RFP_COMMON_message_dropped_cb_t message_dropped_cb);
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_RFP_COMMON_is_message_pending(void)
+ * \brief Check if a message sent by a test mode is still in progress in the EP library.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the message completion has not been received yet, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_RFP_COMMON_is_message_pending(void);
+#endif
+
+#endif
+#endif /* __SIGFOX_RFP_COMMON_H__ */
@@ -0,0 +1,115 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_energy.h
+ * \brief   Sigfox addon RF & Protocol energy accounting
+ * \details This file integrates the time spent in each radio state during a test mode
+ *          and converts it into charge using the user energy model.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __SIGFOX_RFP_ENERGY_H__
+#define __SIGFOX_RFP_ENERGY_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_api_test.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_ENERGY)
+
+/*** SIGFOX RFP ENERGY functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_reset(const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model)
+ * \brief Reset the accounting and select the energy model to use.
+ * \param[in]   energy_model: Currents of the radio states (NULL to only account durations).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_reset(const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model);
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_add_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Account the radio activities of an application message.
+ * \param[in]   application_message: Message sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_add_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param);
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_add_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Account the radio activities of a control message.
+ * \param[in]   control_message: Message sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_add_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param);
+#endif
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_start_window(sfx_u32 duration_ms)
+ * \brief Open a timing window. The part of the window which is not used by the radio is accounted as sleep.
+ * \param[in]   duration_ms: Window duration.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_start_window(sfx_u32 duration_ms);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_stop_window(void)
+ * \brief Close the current timing window, if any.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_stop_window(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_get_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report)
+ * \brief Get the accounting of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  energy_report: Time spent and charge consumed in each radio state.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_get_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report);
+
+#endif
+#endif /* __SIGFOX_RFP_ENERGY_H__ */
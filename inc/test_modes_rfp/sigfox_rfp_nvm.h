@@ -0,0 +1,90 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_nvm.h
+ * \brief   Sigfox addon RF & Protocol NVM stress measurement
+ * \details This file accounts the NVM writes reported by the MCU port and checks the
+ *          message counter stored in NVM after each message of the test mode L stress cycles.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_RFP_NVM_H__
+#define __SIGFOX_RFP_NVM_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_NVM_STRESS)
+
+/*** SIGFOX RFP NVM functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_reset(sfx_u16 message_counter)
+ * \brief Reset the measurement.
+ * \param[in]   message_counter: Message counter read in NVM before the first cycle.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_reset(sfx_u16 message_counter);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_add_write(sfx_u32 write_time_us)
+ * \brief Account one NVM write.
+ * \param[in]   write_time_us: Duration of the write.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_add_write(sfx_u32 write_time_us);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_add_cycle(sfx_u16 message_counter)
+ * \brief Account one completed message and check the message counter stored in NVM.
+ * \param[in]   message_counter: Message counter read in NVM after the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_add_cycle(sfx_u16 message_counter);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_get_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report)
+ * \brief Get the measurement of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  nvm_report: Write count, write time distribution and counter consistency.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_get_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report);
+
+#endif
+#endif /* __SIGFOX_RFP_NVM_H__ */
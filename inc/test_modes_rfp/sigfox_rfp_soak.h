@@ -0,0 +1,127 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_soak.h
+ * \brief   Sigfox addon RF & Protocol soak statistics
+ * \details This file keeps constant size statistics of the messages and timing windows
+ *          of the test modes B and J, which can be read while the test mode is running.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_RFP_SOAK_H__
+#define __SIGFOX_RFP_SOAK_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_SOAK)
+
+/*** SIGFOX RFP SOAK functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms)
+ * \brief Reset the statistics.
+ * \param[in]   get_time_ms: Time source of the addon.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_start_window(sfx_u32 window_duration_ms)
+ * \brief Account the start of a timing window.
+ * \param[in]   window_duration_ms: Planned duration of the window.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_start_window(sfx_u32 window_duration_ms);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_end_window(void)
+ * \brief Account the end of the current timing window and compute its lateness.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_end_window(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_end_iteration(void)
+ * \brief Account a completed pass of the message catalogue.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_end_iteration(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_start_message(void)
+ * \brief Account a message request.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_start_message(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_message_cplt(void)
+ * \brief Account the completion of the requested message. To be called from the message completion callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_message_cplt(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_add_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Account the status of the completed message.
+ * \param[in]   message_status: Status reported by the EP library.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_add_message_status(SIGFOX_EP_API_message_status_t message_status);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_get_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report)
+ * \brief Get the statistics of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  soak_report: Message, error and window statistics.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_get_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report);
+
+#endif
+#endif /* __SIGFOX_RFP_SOAK_H__ */
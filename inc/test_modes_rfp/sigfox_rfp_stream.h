@@ -0,0 +1,111 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_stream.h
+ * \brief   Sigfox addon RF & Protocol result stream encoder
+ * \details This file serializes the test mode start and end, the message status and the received
+ *          downlink frames into TLV records written through the user stream_write hook.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_RFP_STREAM_H__
+#define __SIGFOX_RFP_STREAM_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "sigfox_ep_addon_rfp_stream.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_RESULT_STREAM)
+
+/*** SIGFOX RFP STREAM functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_STREAM_start(SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t stream_write, sfx_u8 test_mode_reference)
+ * \brief Open the stream of a test mode and write its start record.
+ * \param[in]   stream_write: Write hook of the stream, SIGFOX_NULL to disable the stream.
+ * \param[in]   test_mode_reference: Test mode about to start.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_STREAM_start(SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t stream_write, sfx_u8 test_mode_reference);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_STREAM_add_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Write the status of a completed message.
+ * \param[in]   message_status: Status of the completed message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_STREAM_add_message_status(SIGFOX_EP_API_message_status_t message_status);
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_STREAM_add_downlink(sfx_u8 *dl_payload, sfx_u8 dl_payload_size, sfx_s16 rssi_dbm)
+ * \brief Write a received downlink frame.
+ * \param[in]   dl_payload: Downlink payload.
+ * \param[in]   dl_payload_size: Size of the downlink payload.
+ * \param[in]   rssi_dbm: RSSI of the downlink frame.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_STREAM_add_downlink(sfx_u8 *dl_payload, sfx_u8 dl_payload_size, sfx_s16 rssi_dbm);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_STREAM_add_voltage_temperature(sfx_u16 voltage_idle_mv, sfx_u16 voltage_tx_mv, sfx_s16 temperature_tenth_degrees)
+ * \brief Write the voltage and temperature sampled after the last message.
+ * \param[in]   voltage_idle_mv: Idle supply voltage.
+ * \param[in]   voltage_tx_mv: Supply voltage during the last uplink frame, 0 if the message did not send any.
+ * \param[in]   temperature_tenth_degrees: Temperature.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_STREAM_add_voltage_temperature(sfx_u16 voltage_idle_mv, sfx_u16 voltage_tx_mv, sfx_s16 temperature_tenth_degrees);
+#endif
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_STREAM_end(SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status, sfx_u8 status)
+ * \brief Write the end record of the running test mode and close the stream. Nothing is written if the stream is not open.
+ * \param[in]   progress_status: Final progress status of the test mode.
+ * \param[in]   status: Addon status code of the test mode.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_STREAM_end(SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status, sfx_u8 status);
+
+#endif
+#endif /* __SIGFOX_RFP_STREAM_H__ */
@@ -59,12 +59,50 @@ typedef struct {
     void (*process_cb)(void);
     void (*cplt_cb)(void);
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    sfx_u16 start_step;
+    sfx_u8 start_state;
+    void (*checkpoint_cb)(sfx_u16 step, sfx_u8 state);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    sfx_u8 early_stop_threshold_percent;
+    SIGFOX_EP_ADDON_RFP_API_confidence_t early_stop_confidence;
+    SIGFOX_EP_ADDON_RFP_API_early_stop_report_t *early_stop_report;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    sfx_bool regulatory_controls;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    const SIGFOX_EP_ADDON_RFP_API_lbt_profile_t *lbt_profile;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+    SIGFOX_EP_ADDON_RFP_API_public_key_report_t *public_key_report;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    sfx_u16 nvm_stress_cycles;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    const SIGFOX_EP_ADDON_RFP_API_rx_scan_t *rx_scan;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    sfx_bool soak;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    sfx_bool single_pass;
+    SIGFOX_EP_ADDON_RFP_API_single_pass_report_t *single_pass_report;
+#endif
 } SIGFOX_RFP_test_mode_t;
 
 typedef struct {
     SIGFOX_EP_ADDON_RFP_API_status_t (*init_fn)(SIGFOX_RFP_test_mode_t *test_mode_callbacks);
     SIGFOX_EP_ADDON_RFP_API_status_t (*process_fn)(void);
     SIGFOX_EP_ADDON_RFP_API_progress_status_t (*get_progress_status_fn)(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    void (*plan_fn)(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 } SIGFOX_RFP_test_mode_fn_t;
 
 extern const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_A_fn;
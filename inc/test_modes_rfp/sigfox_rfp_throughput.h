@@ -0,0 +1,116 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_throughput.h
+ * \brief   Sigfox addon RF & Protocol throughput measurement
+ * \details This file compares the completion time of the messages sent by the test modes B and J
+ *          to their nominal duration, to measure the delays added by the spectrum access controls.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_RFP_THROUGHPUT_H__
+#define __SIGFOX_RFP_THROUGHPUT_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_api_test.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT)
+
+/*** SIGFOX RFP THROUGHPUT functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms)
+ * \brief Reset the measurement and select the time source to use.
+ * \param[in]   get_time_ms: Free running millisecond counter.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms);
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_start_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Record the request time and the nominal duration of an application message.
+ * \param[in]   application_message: Message about to be sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_start_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param);
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_start_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Record the request time and the nominal duration of a control message.
+ * \param[in]   control_message: Message about to be sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_start_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param);
+#endif
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_message_cplt(void)
+ * \brief Record the completion time of the last started message. Can be called from the message completion callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_message_cplt(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_add_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Account the last completed message.
+ * \param[in]   message_status: Status of the completed message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_add_message_status(SIGFOX_EP_API_message_status_t message_status);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_get_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report)
+ * \brief Get the measurement of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  throughput_report: Achieved frame rate, blocked and deferred messages and added latency.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_get_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report);
+
+#endif
+#endif /* __SIGFOX_RFP_THROUGHPUT_H__ */
@@ -0,0 +1,150 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_timer.h
+ * \brief   Sigfox RFP timer wheel.
+ * \details Multiplexes several logical timers on the single addon MCU timer instance.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __SIGFOX_RFP_TIMER_H__
+#define __SIGFOX_RFP_TIMER_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "manuf/mcu_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+
+/*** SIGFOX RFP TIMER structures ***/
+
+/*!******************************************************************
+ * \enum SIGFOX_RFP_TIMER_id_t
+ * \brief Logical timers sharing the addon MCU timer instance.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_RFP_TIMER_ID_TEST_MODE = 0, /*!< Window, interframe or wait timer of the running test mode */
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    SIGFOX_RFP_TIMER_ID_STEP_DEADLINE, /*!< Deadline of the message currently sent by the test mode */
+#endif
+    SIGFOX_RFP_TIMER_ID_LAST
+} SIGFOX_RFP_TIMER_id_t;
+
+/*!******************************************************************
+ * \brief Sigfox RFP TIMER callback functions.
+ * \fn SIGFOX_RFP_TIMER_cplt_cb_t: Will be called when a logical timer expires. Optional, could be set to NULL.
+ * \fn SIGFOX_RFP_TIMER_process_cb_t: Will be called when the MCU timer expires (IRQ context), @ref SIGFOX_RFP_TIMER_process has to be called as soon as possible.
+ *******************************************************************/
+typedef void (*SIGFOX_RFP_TIMER_cplt_cb_t)(void);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+typedef void (*SIGFOX_RFP_TIMER_process_cb_t)(void);
+#endif
+
+/*** SIGFOX RFP TIMER functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_TIMER_init(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms, SIGFOX_RFP_TIMER_process_cb_t process_cb)
+ * \brief Reset all the logical timers.
+ * \param[in]   get_time_ms: Free running millisecond counter used to compute the deadlines.
+ * \param[in]   process_cb: Process callback (asynchronous mode only).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+void SIGFOX_RFP_TIMER_init(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms, SIGFOX_RFP_TIMER_process_cb_t process_cb);
+#else
+void SIGFOX_RFP_TIMER_init(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms);
+#endif
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_id_t timer_id, sfx_u32 duration_ms, SIGFOX_RFP_TIMER_cplt_cb_t cplt_cb)
+ * \brief Start (or restart) a logical timer. The MCU timer is only re-armed if the nearest deadline changes.
+ * \param[in]   timer_id: Logical timer to start.
+ * \param[in]   duration_ms: Timer duration.
+ * \param[in]   cplt_cb: Callback called when the timer expires.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_id_t timer_id, sfx_u32 duration_ms, SIGFOX_RFP_TIMER_cplt_cb_t cplt_cb);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_id_t timer_id)
+ * \brief Stop a logical timer. The MCU timer is stopped when no logical timer is running anymore.
+ * \param[in]   timer_id: Logical timer to stop.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_id_t timer_id);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_stop_all(void)
+ * \brief Stop all the logical timers and the MCU timer.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_stop_all(void);
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_RFP_TIMER_is_running(SIGFOX_RFP_TIMER_id_t timer_id)
+ * \brief Indicate if a logical timer is running.
+ * \param[in]   timer_id: Logical timer to check.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the timer is running, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_RFP_TIMER_is_running(SIGFOX_RFP_TIMER_id_t timer_id);
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_process(void)
+ * \brief Call the callbacks of the expired logical timers and re-arm the MCU timer for the nearest deadline.
+ * \brief Has to be called after each MCU timer expiration.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_process(void);
+
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_wait_cplt(SIGFOX_RFP_TIMER_id_t timer_id)
+ * \brief Block until a logical timer expires. The other logical timers expiring in the meantime are processed.
+ * \param[in]   timer_id: Logical timer to wait for.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_wait_cplt(SIGFOX_RFP_TIMER_id_t timer_id);
+#endif
+
+#endif
+#endif /* __SIGFOX_RFP_TIMER_H__ */
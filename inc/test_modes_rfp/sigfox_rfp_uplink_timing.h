@@ -0,0 +1,94 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_uplink_timing.h
+ * \brief   Sigfox addon RF & Protocol uplink timing
+ * \details This file timestamps the send call, the uplink completion and the message completion
+ *          of each message sent by the test modes.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_RFP_UPLINK_TIMING_H__
+#define __SIGFOX_RFP_UPLINK_TIMING_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING)
+
+/*** SIGFOX RFP UPLINK TIMING functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms)
+ * \brief Reset the statistics.
+ * \param[in]   get_time_ms: Time source of the addon.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_start_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb, sfx_u32 expected_uplink_ms)
+ * \brief Timestamp the send call and route the uplink and message completions of the message through the timing callbacks.
+ * \param[in]   uplink_cplt_cb: Uplink completion callback of the message, replaced by the timing callback.
+ * \param[in]   message_cplt_cb: Message completion callback of the message, replaced by the timing callback.
+ * \param[in]   expected_uplink_ms: On-air time of the frames and inter-frame delays computed from the message parameters.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_start_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb, sfx_u32 expected_uplink_ms);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_cancel_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb)
+ * \brief Give back the callbacks of a message which could not be sent.
+ * \param[in]   uplink_cplt_cb: Uplink completion callback of the message.
+ * \param[in]   message_cplt_cb: Message completion callback of the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_cancel_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_get_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report)
+ * \brief Get the statistics of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  uplink_timing_report: Pointer to the report to fill.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_get_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report);
+
+#endif
+#endif /* __SIGFOX_RFP_UPLINK_TIMING_H__ */
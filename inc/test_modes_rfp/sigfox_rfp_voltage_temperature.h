@@ -0,0 +1,82 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_voltage_temperature.h
+ * \brief   Sigfox addon RF & Protocol supply voltage and temperature capture
+ * \details This file samples the supply voltage and the temperature given by the MCU driver
+ *          after each message of the test modes.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_RFP_VOLTAGE_TEMPERATURE_H__
+#define __SIGFOX_RFP_VOLTAGE_TEMPERATURE_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE)
+
+/*** SIGFOX RFP VOLTAGE TEMPERATURE functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_VOLTAGE_TEMPERATURE_reset(sfx_bool enable)
+ * \brief Reset the statistics.
+ * \param[in]   enable: Sample the voltage and temperature after each message of the test mode.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_VOLTAGE_TEMPERATURE_reset(sfx_bool enable);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Sample the voltage and temperature after a completed message. The TX voltage is only accounted when an uplink frame was sent.
+ * \param[in]   message_status: Status reported by the EP library.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(SIGFOX_EP_API_message_status_t message_status);
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_VOLTAGE_TEMPERATURE_get_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report)
+ * \brief Get the statistics of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  voltage_temperature_report: Pointer to the report to fill.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_VOLTAGE_TEMPERATURE_get_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report);
+
+#endif
+#endif /* __SIGFOX_RFP_VOLTAGE_TEMPERATURE_H__ */
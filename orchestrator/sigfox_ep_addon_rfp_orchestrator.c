@@ -0,0 +1,466 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_orchestrator.c
+ * \brief   Host orchestrator of the Sigfox addon RF & Protocol test modes over several stations
+ * \details This file distributes test mode jobs over the stations of a test bench. Each station has its own queue and
+ *          thread, and an idle station steals the pending jobs of the busiest station it is able to run.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L // clock_gettime with a strict C standard.
+#endif
+
+#include "sigfox_ep_addon_rfp_orchestrator.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#include <pthread.h>
+#include <time.h>
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR local functions ***/
+
+/*!******************************************************************
+ * \fn static sfx_u32 _get_time_ms(void)
+ * \brief Read the monotonic clock.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Time in milliseconds (wrapping is allowed).
+ *******************************************************************/
+static sfx_u32 _get_time_ms(void) {
+    // Local variables.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (sfx_u32) ((((sfx_u32) now.tv_sec) * 1000) + (sfx_u32) (now.tv_nsec / 1000000));
+}
+
+/*!******************************************************************
+ * \fn static sfx_bool _is_capable(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job)
+ * \brief Check that a station has all the capabilities required by a job.
+ * \param[in]   station: Station instance.
+ * \param[in]   job: Job to run.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the station can run the job.
+ *******************************************************************/
+static sfx_bool _is_capable(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job) {
+    // Local variables.
+    sfx_u8 capabilities = job->capabilities;
+    // Add the capabilities of the test mode reference.
+    switch (job->test_mode.test_mode_reference) {
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_D:
+    case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_E:
+    case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F:
+        capabilities |= SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_BIDIRECTIONAL;
+        break;
+#endif
+#ifdef SIGFOX_EP_SPECTRUM_ACCESS_LBT
+    case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_G:
+        capabilities |= SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_LBT;
+        break;
+#endif
+    default:
+        break;
+    }
+    return (((station->config.capabilities & capabilities) == capabilities) ? SIGFOX_TRUE : SIGFOX_FALSE);
+}
+
+/*!******************************************************************
+ * \fn static void _queue_insert(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job)
+ * \brief Insert a job in the queue of a station, after the jobs with a longer or equal estimated duration.
+ * \param[in]   station: Station instance (locked by the caller or not running).
+ * \param[in]   job: Job to insert.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _queue_insert(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job) {
+    // Local variables.
+    sfx_u16 idx = station->queue_size;
+    while ((idx > 0) && ((station->queue[idx - 1]->estimated_duration_ms) < (job->estimated_duration_ms))) {
+        station->queue[idx] = station->queue[idx - 1];
+        idx--;
+    }
+    station->queue[idx] = job;
+    station->queue_size++;
+    station->pending_ms += job->estimated_duration_ms;
+}
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *_queue_remove(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, sfx_u16 job_index)
+ * \brief Remove a job from the queue of a station.
+ * \param[in]   station: Station instance (locked by the caller).
+ * \param[in]   job_index: Position of the job in the queue.
+ * \param[out]  none
+ * \retval      Removed job.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *_queue_remove(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, sfx_u16 job_index) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job = station->queue[job_index];
+    sfx_u16 idx = 0;
+    for (idx = job_index; (idx + 1) < station->queue_size; idx++) {
+        station->queue[idx] = station->queue[idx + 1];
+    }
+    station->queue_size--;
+    station->pending_ms -= job->estimated_duration_ms;
+    return job;
+}
+
+/*!******************************************************************
+ * \fn static sfx_s32 _queue_find(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *thief)
+ * \brief Find the longest pending job of a station that a thief station is able to run.
+ * \param[in]   station: Victim station (locked by the caller).
+ * \param[in]   thief: Idle station.
+ * \param[out]  none
+ * \retval      Position of the job in the queue, -1 if there is none.
+ *******************************************************************/
+static sfx_s32 _queue_find(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *thief) {
+    // Local variables.
+    sfx_u16 idx = 0;
+    for (idx = 0; idx < station->queue_size; idx++) {
+        if (_is_capable(thief, station->queue[idx]) == SIGFOX_TRUE) {
+            return (sfx_s32) idx;
+        }
+    }
+    return -1;
+}
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *_pop(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station)
+ * \brief Take the longest job of the station queue.
+ * \param[in]   station: Station instance.
+ * \param[out]  none
+ * \retval      Job to run, SIGFOX_NULL if the queue is empty.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *_pop(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job = SIGFOX_NULL;
+    pthread_mutex_lock(&(station->mutex));
+    if (station->queue_size > 0) {
+        job = _queue_remove(station, 0);
+    }
+    pthread_mutex_unlock(&(station->mutex));
+    return job;
+}
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *_steal(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *thief)
+ * \brief Take the longest job that the idle station can run from the station with the most pending work.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[in]   thief: Idle station.
+ * \param[out]  none
+ * \retval      Job to run, SIGFOX_NULL if no station has a job that the thief can run.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *_steal(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *thief) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *victim = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job = SIGFOX_NULL;
+    sfx_u32 victim_pending_ms = 0;
+    sfx_s32 job_index = 0;
+    sfx_u8 idx = 0;
+    // Jobs are never added during a run: the loop ends when no queue holds a job that the thief can run.
+    while (job == SIGFOX_NULL) {
+        // Select victim.
+        victim = SIGFOX_NULL;
+        for (idx = 0; idx < orchestrator->number_of_stations; idx++) {
+            station = &(orchestrator->stations[idx]);
+            if (station == thief) {
+                continue;
+            }
+            pthread_mutex_lock(&(station->mutex));
+            if ((_queue_find(station, thief) >= 0) && ((victim == SIGFOX_NULL) || (station->pending_ms > victim_pending_ms))) {
+                victim = station;
+                victim_pending_ms = station->pending_ms;
+            }
+            pthread_mutex_unlock(&(station->mutex));
+        }
+        if (victim == SIGFOX_NULL) {
+            break;
+        }
+        // The victim may have started the job meanwhile, in which case another victim is selected.
+        pthread_mutex_lock(&(victim->mutex));
+        job_index = _queue_find(victim, thief);
+        if (job_index >= 0) {
+            job = _queue_remove(victim, (sfx_u16) job_index);
+        }
+        pthread_mutex_unlock(&(victim->mutex));
+    }
+    return job;
+}
+
+/*!******************************************************************
+ * \fn static void *_station_thread(void *arg)
+ * \brief Run the jobs of a station, then the jobs stolen from the other stations.
+ * \param[in]   arg: Station instance.
+ * \param[out]  none
+ * \retval      SIGFOX_NULL.
+ *******************************************************************/
+static void *_station_thread(void *arg) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station = (SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *) arg;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator = (SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *) (station->orchestrator);
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job = SIGFOX_NULL;
+    sfx_bool stolen = SIGFOX_FALSE;
+    while (1) {
+        job = _pop(station);
+        stolen = SIGFOX_FALSE;
+        if (job == SIGFOX_NULL) {
+            job = _steal(orchestrator, station);
+            stolen = SIGFOX_TRUE;
+        }
+        if (job == SIGFOX_NULL) {
+            break;
+        }
+        // Run job on the station device.
+        job->station_index = station->index;
+        job->stolen = stolen;
+        job->start_ms = _get_time_ms() - orchestrator->start_ms;
+        job->progress_status = station->config.run_test_mode(station->config.backend, &(job->test_mode));
+        job->end_ms = _get_time_ms() - orchestrator->start_ms;
+        // Update report.
+        station->report.number_of_jobs++;
+        if (stolen == SIGFOX_TRUE) {
+            station->report.number_of_stolen_jobs++;
+        }
+        station->report.busy_ms += (job->end_ms - job->start_ms);
+    }
+    station->report.end_ms = _get_time_ms() - orchestrator->start_ms;
+    return SIGFOX_NULL;
+}
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_init(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator)
+ * \brief Initialize an orchestrator without station. An orchestrator with stations must be released with SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_deinit() first.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_init(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator) {
+    if (orchestrator == SIGFOX_NULL) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_NULL_PARAMETER;
+    }
+    orchestrator->number_of_stations = 0;
+    orchestrator->running = SIGFOX_FALSE;
+    orchestrator->start_ms = 0;
+    return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_add_station(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t *station_config, sfx_u8 *station_index)
+ * \brief Add a station and its backend.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[in]   station_config: Pointer to the station configuration.
+ * \param[out]  station_index: Pointer that will contain the index of the station (optional, could be set to NULL).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_add_station(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t *station_config, sfx_u8 *station_index) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station = SIGFOX_NULL;
+    if ((orchestrator == SIGFOX_NULL) || (station_config == SIGFOX_NULL) || (station_config->run_test_mode == SIGFOX_NULL)) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_NULL_PARAMETER;
+    }
+    if (orchestrator->running == SIGFOX_TRUE) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATE;
+    }
+    if (orchestrator->number_of_stations >= SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_NUMBER_OF_STATIONS_MAX) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATION;
+    }
+    station = &(orchestrator->stations[orchestrator->number_of_stations]);
+    if (pthread_mutex_init(&(station->mutex), SIGFOX_NULL) != 0) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_THREAD;
+    }
+    station->config = (*station_config);
+    station->orchestrator = (void *) orchestrator;
+    station->index = orchestrator->number_of_stations;
+    station->queue_size = 0;
+    station->pending_ms = 0;
+    if (station_index != SIGFOX_NULL) {
+        (*station_index) = orchestrator->number_of_stations;
+    }
+    orchestrator->number_of_stations++;
+    return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_submit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job, sfx_u8 station_index)
+ * \brief Queue a job on a station. With SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY, the job is queued on the capable station with the least pending work.
+ * \brief The job can still be stolen by another capable station during the run.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[in]   job: Pointer to the job.
+ * \param[in]   station_index: Station index or SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_submit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job, sfx_u8 station_index) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *target = SIGFOX_NULL;
+    sfx_u8 idx = 0;
+    if ((orchestrator == SIGFOX_NULL) || (job == SIGFOX_NULL)) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_NULL_PARAMETER;
+    }
+    if (orchestrator->running == SIGFOX_TRUE) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATE;
+    }
+    if (station_index == SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY) {
+        // Capable station with the least pending work.
+        for (idx = 0; idx < orchestrator->number_of_stations; idx++) {
+            station = &(orchestrator->stations[idx]);
+            if ((_is_capable(station, job) == SIGFOX_TRUE) && ((target == SIGFOX_NULL) || (station->pending_ms < target->pending_ms))) {
+                target = station;
+            }
+        }
+    }
+    else {
+        if (station_index >= orchestrator->number_of_stations) {
+            return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATION;
+        }
+        target = &(orchestrator->stations[station_index]);
+        if (_is_capable(target, job) == SIGFOX_FALSE) {
+            target = SIGFOX_NULL;
+        }
+    }
+    if (target == SIGFOX_NULL) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_CAPABILITY;
+    }
+    if (target->queue_size >= SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_NUMBER_OF_JOBS_MAX) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_QUEUE_FULL;
+    }
+    job->station_index = SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY;
+    job->stolen = SIGFOX_FALSE;
+    _queue_insert(target, job);
+    return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator)
+ * \brief Start one thread per station and wait until all the queued jobs are completed.
+ * \brief When a station thread can not be started, the other stations still run the jobs they are able to and SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_THREAD is returned.
+ * \brief The jobs that have not been run are kept in the queues (number_of_pending_jobs of the station reports) and are run by the next call.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t status = SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t *station = SIGFOX_NULL;
+    sfx_u8 number_of_threads = 0;
+    sfx_u8 idx = 0;
+    if (orchestrator == SIGFOX_NULL) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_NULL_PARAMETER;
+    }
+    if (orchestrator->running == SIGFOX_TRUE) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATE;
+    }
+    orchestrator->running = SIGFOX_TRUE;
+    orchestrator->start_ms = _get_time_ms();
+    for (idx = 0; idx < orchestrator->number_of_stations; idx++) {
+        station = &(orchestrator->stations[idx]);
+        station->report.number_of_jobs = 0;
+        station->report.number_of_stolen_jobs = 0;
+        station->report.busy_ms = 0;
+        station->report.end_ms = 0;
+        station->report.number_of_pending_jobs = 0;
+    }
+    // Start station threads.
+    for (idx = 0; idx < orchestrator->number_of_stations; idx++) {
+        if (pthread_create(&(orchestrator->stations[idx].thread), SIGFOX_NULL, &_station_thread, &(orchestrator->stations[idx])) != 0) {
+            // The started stations still run the jobs they are able to.
+            status = SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_THREAD;
+            break;
+        }
+        number_of_threads++;
+    }
+    // Wait for the end of all jobs.
+    for (idx = 0; idx < number_of_threads; idx++) {
+        pthread_join(orchestrator->stations[idx].thread, SIGFOX_NULL);
+    }
+    // Jobs that no started station was able to run are kept for the next run.
+    for (idx = 0; idx < orchestrator->number_of_stations; idx++) {
+        station = &(orchestrator->stations[idx]);
+        station->report.number_of_pending_jobs = station->queue_size;
+    }
+    orchestrator->running = SIGFOX_FALSE;
+    return status;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_get_station_report(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, sfx_u8 station_index, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t *station_report)
+ * \brief Get the activity of a station during the last run.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[in]   station_index: Station index.
+ * \param[out]  station_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_get_station_report(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, sfx_u8 station_index, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t *station_report) {
+    if ((orchestrator == SIGFOX_NULL) || (station_report == SIGFOX_NULL)) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_NULL_PARAMETER;
+    }
+    if (orchestrator->running == SIGFOX_TRUE) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATE;
+    }
+    if (station_index >= orchestrator->number_of_stations) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATION;
+    }
+    (*station_report) = orchestrator->stations[station_index].report;
+    return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_deinit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator)
+ * \brief Release the resources of the stations and remove them. The pending jobs are dropped.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_deinit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    if (orchestrator == SIGFOX_NULL) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_NULL_PARAMETER;
+    }
+    if (orchestrator->running == SIGFOX_TRUE) {
+        return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATE;
+    }
+    for (idx = 0; idx < orchestrator->number_of_stations; idx++) {
+        pthread_mutex_destroy(&(orchestrator->stations[idx].mutex));
+    }
+    orchestrator->number_of_stations = 0;
+    return SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS;
+}
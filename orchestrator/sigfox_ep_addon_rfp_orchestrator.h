@@ -0,0 +1,214 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_orchestrator.h
+ * \brief   Host orchestrator of the Sigfox addon RF & Protocol test modes over several stations
+ * \details This file distributes test mode jobs over the stations of a test bench. Each station has its own queue and
+ *          thread, and an idle station steals the pending jobs of the busiest station it is able to run.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef __SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_H__
+#define __SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_H__
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#include <pthread.h>
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR macros ***/
+
+#define SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_NUMBER_OF_STATIONS_MAX     16
+#define SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_NUMBER_OF_JOBS_MAX         128 // Per station queue.
+#define SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY                0xFF
+
+// Station capabilities.
+#define SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_BIDIRECTIONAL   0x01 // Downlink reception, required by the test modes D, E and F.
+#define SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_LBT             0x02 // Carrier sense environment, required by the test mode G.
+#define SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_USER            0x10 // First capability bit free for the application (shield box, power analyzer...).
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR structures ***/
+
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t
+ * \brief Orchestrator error codes.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_SUCCESS = 0,
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_NULL_PARAMETER,
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATE, /*!< Stations and jobs can not be added while the orchestrator is running */
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_STATION, /*!< Invalid station index or too many stations */
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_CAPABILITY, /*!< The station (or every station with STATION_ANY) lacks a capability required by the job */
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_QUEUE_FULL,
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_THREAD,
+} SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t;
+
+/*!******************************************************************
+ * \brief Orchestrator backend callback.
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run_test_mode_cb_t: Run a test mode on the device of the station (through the POSIX port, the command front-end or a simulator) and return when it is completed.
+ * \fn Called from the thread of the station, the backends of the different stations are called concurrently.
+ *******************************************************************/
+typedef SIGFOX_EP_ADDON_RFP_API_progress_status_t (*SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run_test_mode_cb_t)(void *backend, SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode);
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t
+ * \brief Station configuration structure.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run_test_mode_cb_t run_test_mode;
+    void *backend; /*!< Given back to the backend callback */
+    sfx_u8 capabilities; /*!< SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_CAPABILITY_xxx bits */
+} SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t
+ * \brief Test mode job. The job is owned by the application and must remain valid until the end of the run.
+ *******************************************************************/
+typedef struct {
+    // Filled by the application.
+    SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode; /*!< Test mode descriptor given to the backend */
+    sfx_u32 estimated_duration_ms; /*!< Longest jobs are started first (SIGFOX_EP_ADDON_RFP_API_plan_test_mode() gives it with the planner) */
+    sfx_u8 capabilities; /*!< Capabilities required in addition to the ones of the test mode reference */
+    // Filled by the orchestrator.
+    sfx_u8 station_index; /*!< Station which ran the job, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY if the job has not been run */
+    sfx_bool stolen; /*!< The job was taken from the queue of another station */
+    SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
+    sfx_u32 start_ms; /*!< Relative to the start of the run */
+    sfx_u32 end_ms;
+} SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t
+ * \brief Station activity of the last run.
+ *******************************************************************/
+typedef struct {
+    sfx_u16 number_of_jobs;
+    sfx_u16 number_of_stolen_jobs; /*!< Jobs taken from the queue of another station */
+    sfx_u32 busy_ms;
+    sfx_u32 end_ms; /*!< Time when the station ran out of jobs, relative to the start of the run */
+    sfx_u16 number_of_pending_jobs; /*!< Jobs left in the queue at the end of the run, when a station thread could not be started */
+} SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t
+ * \brief Station instance (internal).
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t config;
+    void *orchestrator; /*!< Back pointer given to the station thread */
+    sfx_u8 index;
+    pthread_t thread;
+    pthread_mutex_t mutex; /*!< Protects the queue against the thieves */
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *queue[SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_NUMBER_OF_JOBS_MAX]; /*!< Pending jobs by decreasing estimated duration */
+    sfx_u16 queue_size;
+    sfx_u32 pending_ms; /*!< Sum of the estimated durations of the pending jobs */
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t report;
+} SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t
+ * \brief Orchestrator instance.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_t stations[SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_NUMBER_OF_STATIONS_MAX];
+    sfx_u8 number_of_stations;
+    sfx_bool running;
+    sfx_u32 start_ms;
+} SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t;
+
+/*** SIGFOX EP ADDON RFP ORCHESTRATOR functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_init(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator)
+ * \brief Initialize an orchestrator without station. An orchestrator with stations must be released with SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_deinit() first.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_init(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_add_station(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t *station_config, sfx_u8 *station_index)
+ * \brief Add a station and its backend.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[in]   station_config: Pointer to the station configuration.
+ * \param[out]  station_index: Pointer that will contain the index of the station (optional, could be set to NULL).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_add_station(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_config_t *station_config, sfx_u8 *station_index);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_submit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job, sfx_u8 station_index)
+ * \brief Queue a job on a station. With SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY, the job is queued on the capable station with the least pending work.
+ * \brief The job can still be stolen by another capable station during the run.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[in]   job: Pointer to the job.
+ * \param[in]   station_index: Station index or SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_STATION_ANY.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_submit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_job_t *job, sfx_u8 station_index);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator)
+ * \brief Start one thread per station and wait until all the queued jobs are completed.
+ * \brief When a station thread can not be started, the other stations still run the jobs they are able to and SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_ERROR_THREAD is returned.
+ * \brief The jobs that have not been run are kept in the queues (number_of_pending_jobs of the station reports) and are run by the next call.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_run(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_get_station_report(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, sfx_u8 station_index, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t *station_report)
+ * \brief Get the activity of a station during the last run.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[in]   station_index: Station index.
+ * \param[out]  station_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_get_station_report(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator, sfx_u8 station_index, SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_station_report_t *station_report);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_deinit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator)
+ * \brief Release the resources of the stations and remove them. The pending jobs are dropped.
+ * \param[in]   orchestrator: Orchestrator instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_status_t SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_deinit(SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_t *orchestrator);
+
+#endif /* __SIGFOX_EP_ADDON_RFP_ORCHESTRATOR_H__ */
@@ -39,6 +39,36 @@
 #include "sigfox_ep_addon_rfp_version.h"
 #include "sigfox_ep_api.h"
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+#include "test_modes_rfp/sigfox_rfp_energy.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+#include "test_modes_rfp/sigfox_rfp_throughput.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+#include "test_modes_rfp/sigfox_rfp_nvm.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+#include "test_modes_rfp/sigfox_rfp_soak.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+#include "test_modes_rfp/sigfox_rfp_uplink_timing.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_POSIX
+#include "sigfox_ep_addon_rfp_posix.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+#include "test_modes_rfp/sigfox_rfp_timer.h"
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+#include "test_modes_rfp/sigfox_rfp_common.h"
+#endif
 #ifdef SIGFOX_EP_CERTIFICATION
 
 typedef enum {
@@ -47,6 +77,10 @@ typedef enum {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS,
 #endif
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    // Test mode aborted, waiting for the completion of the message in progress in the EP library.
+    SIGFOX_EP_ADDON_RFP_API_STATE_ABORT,
+#endif
 } SIGFOX_EP_ADDON_RFP_API_state_t;
 
 #ifdef SIGFOX_EP_ASYNCHRONOUS
@@ -56,9 +90,23 @@ typedef union {
         sfx_u8 ep_api_process :1;
         sfx_u8 rfp_test_mode_process :1;
         sfx_u8 rfp_test_mode_cplt :1;
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+        sfx_u8 rfp_timer_process :1;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+        sfx_u8 rfp_step_timeout :1;
+#endif
     };
     sfx_u8 all;
 } SIGFOX_EP_ADDON_RFP_API_flags_t;
+
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE)
+#define SIGFOX_EP_ADDON_RFP_API_EVENT_FLAGS_MASK    0x1F
+#elif (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+#define SIGFOX_EP_ADDON_RFP_API_EVENT_FLAGS_MASK    0x0F
+#else
+#define SIGFOX_EP_ADDON_RFP_API_EVENT_FLAGS_MASK    0x07
+#endif
 #endif
 
 typedef struct {
@@ -67,9 +115,54 @@ typedef struct {
     SIGFOX_EP_ADDON_RFP_API_state_t state;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     volatile SIGFOX_EP_ADDON_RFP_API_flags_t flags;
+    // Set when the process callback has been called and the process function has not run yet.
+    // Kept out of the flags byte so that its update never rewrites the IRQ flags.
+    volatile sfx_u8 process_pending;
     SIGFOX_EP_ADDON_RFP_API_process_cb_t process_cb;
     SIGFOX_EP_ADDON_RFP_API_test_mode_cplt_cb_t test_mode_cplt_cb;
 #endif
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t plan;
+    sfx_u32 start_time_ms;
+    sfx_u32 end_time_ms;
+    sfx_bool test_mode_running;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    sfx_bool step_timeout;
+    sfx_u32 step_deadline_margin_ms;
+    SIGFOX_EP_API_config_t ep_api_config;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    sfx_bool aborted;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    SIGFOX_EP_ADDON_RFP_API_get_time_us_cb_t get_time_us;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    SIGFOX_EP_ADDON_RFP_API_checkpoint_write_cb_t checkpoint_write;
+    SIGFOX_EP_ADDON_RFP_API_checkpoint_read_cb_t checkpoint_read;
+    sfx_u16 checkpoint_period;
+    SIGFOX_EP_ADDON_RFP_API_checkpoint_t checkpoint;
+    sfx_bool resume;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    SIGFOX_EP_ADDON_RFP_API_early_stop_report_t early_stop_report;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    SIGFOX_EP_ADDON_RFP_API_single_pass_report_t single_pass_report;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+    SIGFOX_EP_ADDON_RFP_API_public_key_report_t public_key_report;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t stream_write;
+#endif
 } SIGFOX_EP_ADDON_RFP_API_context_t;
 
 /*** SIGFOX EP API local global variables ***/
@@ -82,9 +175,70 @@ static SIGFOX_EP_ADDON_RFP_API_context_t sigfox_ep_addon_rfp_api_ctx = {
     .flags.ep_api_process = 0,
     .flags.rfp_test_mode_process = 0,
     .flags.rfp_test_mode_cplt = 0,
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+    .flags.rfp_timer_process = 0,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    .flags.rfp_step_timeout = 0,
+#endif
+    .process_pending = 0,
     .process_cb = SIGFOX_NULL,
     .test_mode_cplt_cb = SIGFOX_NULL,
 #endif
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    .get_time_ms = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan.duration_ms = 0,
+    .plan.number_of_messages = 0,
+    .plan.number_of_frames = 0,
+    .plan.open_ended = SIGFOX_FALSE,
+    .start_time_ms = 0,
+    .end_time_ms = 0,
+    .test_mode_running = SIGFOX_FALSE,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    .energy_model = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    .step_timeout = SIGFOX_FALSE,
+    .step_deadline_margin_ms = 0,
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    .aborted = SIGFOX_FALSE,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    .get_time_us = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    .checkpoint_write = SIGFOX_NULL,
+    .checkpoint_read = SIGFOX_NULL,
+    .checkpoint_period = 0,
+    .checkpoint.test_mode_reference = 0,
+    .checkpoint.state = 0,
+    .checkpoint.step = 0,
+    .resume = SIGFOX_FALSE,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    .early_stop_report.verdict = SIGFOX_EP_ADDON_RFP_API_VERDICT_PENDING,
+    .early_stop_report.number_of_windows = 0,
+    .early_stop_report.number_of_received = 0,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    .single_pass_report.single_pass = SIGFOX_FALSE,
+    .single_pass_report.number_of_gaps = 0,
+    .single_pass_report.gap_min_ms = 0,
+    .single_pass_report.gap_max_ms = 0,
+    .single_pass_report.last_gap_ms = 0,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+    .public_key_report.number_of_messages = 0,
+    .public_key_report.number_of_completed = 0,
+    .public_key_report.number_of_frames_sent = 0,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    .stream_write = SIGFOX_NULL,
+#endif
 };
 
 /*** SIGFOX EP API local functions ***/
@@ -98,7 +252,62 @@ static SIGFOX_EP_ADDON_RFP_API_context_t sigfox_ep_addon_rfp_api_ctx = {
  *******************************************************************/
 #define _CHECK_RFP_STATE(state_condition) { if (sigfox_ep_addon_rfp_api_ctx.state state_condition) { SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE); } }
 
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+/*!******************************************************************
+ * \fn sfx_u8 _STREAM_ERROR_STATUS
+ * \brief Status code written in the end record of a test mode aborted on error.
+ *******************************************************************/
+#ifdef SIGFOX_EP_ERROR_CODES
+#define _STREAM_ERROR_STATUS    ((sfx_u8) status)
+#else
+#define _STREAM_ERROR_STATUS    SIGFOX_EP_ADDON_RFP_STREAM_STATUS_ERROR
+#endif
+#endif
+
 #ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn void _ENTER_CRITICAL(void)
+ * \brief Protect the event flags when they can be updated concurrently by several threads.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+#ifdef SIGFOX_EP_ADDON_RFP_POSIX
+#define _ENTER_CRITICAL()   SIGFOX_EP_ADDON_RFP_POSIX_enter_critical()
+#define _EXIT_CRITICAL()    SIGFOX_EP_ADDON_RFP_POSIX_exit_critical()
+#else
+#define _ENTER_CRITICAL()
+#define _EXIT_CRITICAL()
+#endif
+
+/*!******************************************************************
+ * \fn void _SET_FLAG(flag, value)
+ * \brief Update an event flag in critical section.
+ * \param[in]   flag: Name of the flag to update.
+ * \param[in]   value: New value of the flag.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+#define _SET_FLAG(flag, value) { _ENTER_CRITICAL(); sigfox_ep_addon_rfp_api_ctx.flags.flag = value; _EXIT_CRITICAL(); }
+#endif
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn static void _notify_process(void)
+ * \brief Call the process callback if not already done since the last process function call.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _notify_process(void) {
+    if (sigfox_ep_addon_rfp_api_ctx.process_pending == 0) {
+        sigfox_ep_addon_rfp_api_ctx.process_pending = 1;
+        if (sigfox_ep_addon_rfp_api_ctx.process_cb != SIGFOX_NULL) {
+            sigfox_ep_addon_rfp_api_ctx.process_cb();
+        }
+    }
+}
+
 /*!******************************************************************
  * \fn void _SIGFOX_EP_API_process_callback(void)
  * \brief Execute the process callback if the not null.
@@ -107,10 +316,10 @@ static SIGFOX_EP_ADDON_RFP_API_context_t sigfox_ep_addon_rfp_api_ctx = {
  * \retval      none
  *******************************************************************/
 static void _SIGFOX_EP_API_process_callback(void) {
+    _ENTER_CRITICAL();
     sigfox_ep_addon_rfp_api_ctx.flags.ep_api_process = 1;
-    if (sigfox_ep_addon_rfp_api_ctx.process_cb != SIGFOX_NULL) {
-        sigfox_ep_addon_rfp_api_ctx.process_cb();
-    }
+    _notify_process();
+    _EXIT_CRITICAL();
 }
 
 /*!******************************************************************
@@ -121,10 +330,10 @@ static void _SIGFOX_EP_API_process_callback(void) {
  * \retval      none
  *******************************************************************/
 static void _SIGFOX_RFP_TEST_MODE_process_callback(void) {
+    _ENTER_CRITICAL();
     sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_process = 1;
-    if (sigfox_ep_addon_rfp_api_ctx.process_cb != SIGFOX_NULL) {
-        sigfox_ep_addon_rfp_api_ctx.process_cb();
-    }
+    _notify_process();
+    _EXIT_CRITICAL();
 }
 
 /*!******************************************************************
@@ -135,267 +344,1006 @@ static void _SIGFOX_RFP_TEST_MODE_process_callback(void) {
  * \retval      none
  *******************************************************************/
 static void _SIGFOX_RFP_TEST_MODE_completion_callback(void) {
+    _ENTER_CRITICAL();
     sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_cplt = 1;
-    if (sigfox_ep_addon_rfp_api_ctx.process_cb != SIGFOX_NULL) {
-        sigfox_ep_addon_rfp_api_ctx.process_cb();
-    }
+    _notify_process();
+    _EXIT_CRITICAL();
 }
-#endif
-
-/*** SIGFOX EP API functions ***/
 
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
 /*!******************************************************************
- * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_open(SIGFOX_EP_ADDON_RFP_API_config_t *config)
- * \brief Open the RFP addon.
- * \param[in]   config: Pointer to the rfp addon configuration.
+ * \fn static void _SIGFOX_RFP_TIMER_process_callback(void)
+ * \brief Request the timer wheel processing on MCU timer expiration.
+ * \param[in]   none
  * \param[out]  none
- * \retval      Function execution status.
+ * \retval      none
  *******************************************************************/
-SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_open(SIGFOX_EP_ADDON_RFP_API_config_t *config) {
-    // Local variables.
-    SIGFOX_EP_API_config_t ep_api_config;
-#ifdef SIGFOX_EP_ERROR_CODES
-    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
-    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
-#endif
-    // Check RFP ADDON state.
-    _CHECK_RFP_STATE(!= SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
-    // Open EP library.
-    ep_api_config.rc = config->rc;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    ep_api_config.process_cb = &_SIGFOX_EP_API_process_callback;
-#endif
-#ifndef SIGFOX_EP_MESSAGE_COUNTER_ROLLOVER
-    ep_api_config.message_counter_rollover = config->message_counter_rollover;
-#endif
-    // Open library.
-#ifdef SIGFOX_EP_ERROR_CODES
-    sigfox_ep_api_status = SIGFOX_EP_API_open(&ep_api_config);
-    SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
-#else
-    SIGFOX_EP_API_open(&ep_api_config);
-#endif
-    // Store and configure parameters into static context if no error occurred.
-    sigfox_ep_addon_rfp_api_ctx.rc = config->rc;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    sigfox_ep_addon_rfp_api_ctx.process_cb = config->process_cb;
-#endif
-    // Update ADDON RFP state if no error occurred.
-    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_READY;
-errors:
-#ifdef SIGFOX_EP_ERROR_CODES
-    return status;
-#else
-    return;
-#endif
+static void _SIGFOX_RFP_TIMER_process_callback(void) {
+    _ENTER_CRITICAL();
+    sigfox_ep_addon_rfp_api_ctx.flags.rfp_timer_process = 1;
+    _notify_process();
+    _EXIT_CRITICAL();
 }
-
-SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_close(void) {
-    // Local variables.
-#ifdef SIGFOX_EP_ERROR_CODES
-    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
-    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
-#endif
-    // Close EP library.
-#ifdef SIGFOX_EP_ERROR_CODES
-    sigfox_ep_api_status = SIGFOX_EP_API_close();
-    SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
-#else
-    SIGFOX_EP_API_close();
-#endif
-    // Reset parameters into static context
-    sigfox_ep_addon_rfp_api_ctx.rc = SIGFOX_NULL;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    sigfox_ep_addon_rfp_api_ctx.process_cb = SIGFOX_NULL;
-#endif
-    // Update ADDON RFP state if no error occurred.
-    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE;
-#ifdef SIGFOX_EP_ERROR_CODES
-errors:
 #endif
-    SIGFOX_RETURN();
-}
 
-#ifdef SIGFOX_EP_ASYNCHRONOUS
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
 /*!******************************************************************
- * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process(void)
- * \brief Main process function of the RFP addon.
- * \brief In asynchronous mode, this function is called by the client when the process callback is triggered.
- * \brief In blocking mode, this function is called by the library itself until the requested operation is completed.
+ * \fn static void _SIGFOX_RFP_COMMON_deadline_callback(void)
+ * \brief Request the abort of the running test mode when a message is not completed in time.
  * \param[in]   none
  * \param[out]  none
- * \retval      Function execution status.
+ * \retval      none
  *******************************************************************/
-SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process(void) {
-    // Local variables.
-#ifdef SIGFOX_EP_ERROR_CODES
-    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
-    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
-#endif
-    if (sigfox_ep_addon_rfp_api_ctx.flags.ep_api_process == 1) {
-#ifdef SIGFOX_EP_ERROR_CODES
-        sigfox_ep_api_status = SIGFOX_EP_API_process();
-        sigfox_ep_addon_rfp_api_ctx.flags.ep_api_process = 0;
-        SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
-#else
-        SIGFOX_EP_API_process();
+static void _SIGFOX_RFP_COMMON_deadline_callback(void) {
+    _ENTER_CRITICAL();
+    sigfox_ep_addon_rfp_api_ctx.flags.rfp_step_timeout = 1;
+    _notify_process();
+    _EXIT_CRITICAL();
+}
 #endif
-    }
 
-    switch (sigfox_ep_addon_rfp_api_ctx.state) {
-    case SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE:
-        break;
-    case SIGFOX_EP_ADDON_RFP_API_STATE_READY:
-        break;
-    case SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS:
-        if (sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_process == 1) {
-            if (sigfox_ep_addon_rfp_api_ctx.test_mode_fn != SIGFOX_NULL) {
-#ifdef SIGFOX_EP_ERROR_CODES
-                status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else
-                sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
+/*!******************************************************************
+ * \fn static void _end_process(void)
+ * \brief Release the process callback and call it again if an event occurred in the meantime.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _end_process(void) {
+    _ENTER_CRITICAL();
+    sigfox_ep_addon_rfp_api_ctx.process_pending = 0;
+    if ((sigfox_ep_addon_rfp_api_ctx.flags.all & SIGFOX_EP_ADDON_RFP_API_EVENT_FLAGS_MASK) != 0) {
+        _notify_process();
+    }
+    _EXIT_CRITICAL();
+}
 #endif
-            }
-            sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_process = 0;
-        }
-        if (sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_cplt == 1) {
 
-            if (sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb != SIGFOX_NULL) {
-                sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb();
-            }
-            sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_cplt = 0;
-            sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_READY;
-        }
-        break;
-    default:
-        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+/*!******************************************************************
+ * \fn static void _SIGFOX_RFP_TEST_MODE_checkpoint_callback(sfx_u16 step, sfx_u8 state)
+ * \brief Store the progress of the running test mode every checkpoint period.
+ * \param[in]   step: Number of completed steps.
+ * \param[in]   state: Test mode specific state needed to resume the next step.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _SIGFOX_RFP_TEST_MODE_checkpoint_callback(sfx_u16 step, sfx_u8 state) {
+    if ((sigfox_ep_addon_rfp_api_ctx.checkpoint_write == SIGFOX_NULL) || (sigfox_ep_addon_rfp_api_ctx.checkpoint_period == 0)) {
+        return;
     }
-    SIGFOX_RETURN();
-errors:
-    if (sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb != SIGFOX_NULL) {
-        sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb();
+    if ((step % sigfox_ep_addon_rfp_api_ctx.checkpoint_period) != 0) {
+        return;
     }
-    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_READY;
-    SIGFOX_RETURN();
+    sigfox_ep_addon_rfp_api_ctx.checkpoint.step = step;
+    sigfox_ep_addon_rfp_api_ctx.checkpoint.state = state;
+    sigfox_ep_addon_rfp_api_ctx.checkpoint_write(&(sigfox_ep_addon_rfp_api_ctx.checkpoint));
 }
-#endif
 
 /*!******************************************************************
- * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode)
- * \brief Execute a specific test mode for RF & Protocol test.
- * \param[in]   test_mode: Pointer to the test_mode data.
+ * \fn static void _end_checkpoint(void)
+ * \brief Clear the stored checkpoint once the test mode is successfully completed.
+ * \param[in]   none
  * \param[out]  none
- * \retval      Function execution status.
+ * \retval      none
  *******************************************************************/
-SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode) {
+static void _end_checkpoint(void) {
     // Local variables.
-#ifdef SIGFOX_EP_ERROR_CODES
-    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
+    if ((sigfox_ep_addon_rfp_api_ctx.checkpoint_write == SIGFOX_NULL) || (sigfox_ep_addon_rfp_api_ctx.checkpoint_period == 0)) {
+        return;
+    }
+    progress_status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->get_progress_status_fn();
+    if ((progress_status.status.error == 0) && (progress_status.progress >= 100)) {
+        sigfox_ep_addon_rfp_api_ctx.checkpoint.step = 0;
+        sigfox_ep_addon_rfp_api_ctx.checkpoint.state = 0;
+        sigfox_ep_addon_rfp_api_ctx.checkpoint_write(&(sigfox_ep_addon_rfp_api_ctx.checkpoint));
+    }
+}
 #endif
-    SIGFOX_RFP_test_mode_t rfp_test_mode;
-    // Check RFP ADDON is opened.
-    _CHECK_RFP_STATE(!= SIGFOX_EP_ADDON_RFP_API_STATE_READY);
-    switch (test_mode->test_mode_reference) {
+
+/*!******************************************************************
+ * \fn static const SIGFOX_RFP_test_mode_fn_t *_get_test_mode_fn(SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t test_mode_reference)
+ * \brief Get the functions table of a test mode.
+ * \param[in]   test_mode_reference: Test mode to look for.
+ * \param[out]  none
+ * \retval      Pointer to the test mode functions, SIGFOX_NULL if the test mode is not supported.
+ *******************************************************************/
+static const SIGFOX_RFP_test_mode_fn_t *_get_test_mode_fn(SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t test_mode_reference) {
+    // Local variables.
+    const SIGFOX_RFP_test_mode_fn_t *test_mode_fn = SIGFOX_NULL;
+    switch (test_mode_reference) {
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_A:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_A_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_A_fn;
         break;
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_B:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_B_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_B_fn;
         break;
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_C:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_C_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_C_fn;
         break;
 #if defined SIGFOX_EP_BIDIRECTIONAL
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_D:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_D_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_D_fn;
         break;
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_E:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_E_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_E_fn;
         break;
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_F:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_F_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_F_fn;
         break;
 #endif
 #ifdef SIGFOX_EP_SPECTRUM_ACCESS_LBT
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_G:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_G_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_G_fn;
         break;
 #endif
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_J:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_J_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_J_fn;
         break;
 #ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_K:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_K_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_K_fn;
         break;
 #endif
     case SIGFOX_EP_ADDON_RFP_API_TEST_MODE_L:
-        sigfox_ep_addon_rfp_api_ctx.test_mode_fn = &SIGFOX_RFP_TEST_MODE_L_fn;
+        test_mode_fn = &SIGFOX_RFP_TEST_MODE_L_fn;
         break;
     default:
-#ifdef SIGFOX_EP_ERROR_CODES
-        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE)
-#else
-        goto errors;
-#endif
+        break;
     }
+    return test_mode_fn;
+}
+
+/*!******************************************************************
+ * \fn static void _set_rfp_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode, SIGFOX_RFP_test_mode_t *rfp_test_mode)
+ * \brief Fill the internal test mode parameters from the user ones.
+ * \param[in]   test_mode: Pointer to the test_mode data.
+ * \param[out]  rfp_test_mode: Pointer to the internal test mode parameters.
+ * \retval      none
+ *******************************************************************/
+static void _set_rfp_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode, SIGFOX_RFP_test_mode_t *rfp_test_mode) {
+#if (defined SIGFOX_EP_UL_BIT_RATE_BPS) && (defined SIGFOX_EP_TX_POWER_DBM_EIRP)
+    (void) test_mode;
+#endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
-    sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_process = 0;
-    sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_cplt = 0;
-    sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb = test_mode->test_mode_cplt_cb;
-    rfp_test_mode.process_cb = _SIGFOX_RFP_TEST_MODE_process_callback;
-    rfp_test_mode.cplt_cb = _SIGFOX_RFP_TEST_MODE_completion_callback;
+    rfp_test_mode->process_cb = _SIGFOX_RFP_TEST_MODE_process_callback;
+    rfp_test_mode->cplt_cb = _SIGFOX_RFP_TEST_MODE_completion_callback;
 #endif
-    rfp_test_mode.rc = sigfox_ep_addon_rfp_api_ctx.rc;
+    rfp_test_mode->rc = sigfox_ep_addon_rfp_api_ctx.rc;
 #ifndef SIGFOX_EP_UL_BIT_RATE_BPS
-    rfp_test_mode.ul_bit_rate = test_mode->ul_bit_rate;
+    rfp_test_mode->ul_bit_rate = test_mode->ul_bit_rate;
 #endif
 #ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
-    rfp_test_mode.tx_power_dbm_eirp = test_mode->tx_power_dbm_eirp;
+    rfp_test_mode->tx_power_dbm_eirp = test_mode->tx_power_dbm_eirp;
 #endif
 #ifdef SIGFOX_EP_BIDIRECTIONAL
-    rfp_test_mode.downlink_cplt_cb = test_mode->downlink_cplt_cb;
+    rfp_test_mode->downlink_cplt_cb = test_mode->downlink_cplt_cb;
 #endif
-    if (sigfox_ep_addon_rfp_api_ctx.test_mode_fn == SIGFOX_NULL)
-#ifdef SIGFOX_EP_ERROR_CODES
-        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE)
-#else
-        goto errors;
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    rfp_test_mode->start_step = 0;
+    rfp_test_mode->start_state = 0;
+    rfp_test_mode->checkpoint_cb = &_SIGFOX_RFP_TEST_MODE_checkpoint_callback;
 #endif
-#ifdef SIGFOX_EP_ERROR_CODES
-    status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->init_fn(&rfp_test_mode);
-    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else
-    sigfox_ep_addon_rfp_api_ctx.test_mode_fn->init_fn(&rfp_test_mode);
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    rfp_test_mode->early_stop_threshold_percent = test_mode->early_stop_threshold_percent;
+    rfp_test_mode->early_stop_confidence = test_mode->early_stop_confidence;
+    rfp_test_mode->early_stop_report = &(sigfox_ep_addon_rfp_api_ctx.early_stop_report);
 #endif
-
-#ifdef SIGFOX_EP_ERROR_CODES
-    status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
-    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else
-    sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    rfp_test_mode->regulatory_controls = test_mode->regulatory_controls;
 #endif
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS;
-    if (sigfox_ep_addon_rfp_api_ctx.process_cb == SIGFOX_NULL) {
-        // Block until library goes back to READY state.
-        while (sigfox_ep_addon_rfp_api_ctx.state != SIGFOX_EP_ADDON_RFP_API_STATE_READY) {
-#ifdef SIGFOX_EP_ERROR_CODES
-            status = SIGFOX_EP_ADDON_RFP_API_process();
-            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else // SIGFOX_EP_ERROR_CODES
-            SIGFOX_EP_API_process();
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    rfp_test_mode->lbt_profile = test_mode->lbt_profile;
 #endif
-        }
-    }
-#else // SYNCHRONOUS
-
+#if (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    rfp_test_mode->get_time_ms = sigfox_ep_addon_rfp_api_ctx.get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+    rfp_test_mode->public_key_report = &(sigfox_ep_addon_rfp_api_ctx.public_key_report);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    rfp_test_mode->nvm_stress_cycles = test_mode->nvm_stress_cycles;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    rfp_test_mode->rx_scan = test_mode->rx_scan;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    rfp_test_mode->soak = test_mode->soak;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    rfp_test_mode->single_pass = test_mode->single_pass;
+    rfp_test_mode->single_pass_report = &(sigfox_ep_addon_rfp_api_ctx.single_pass_report);
+#endif
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+/*!******************************************************************
+ * \fn static void _end_stream(sfx_u8 status)
+ * \brief Write the end record of the running test mode in the result stream.
+ * \param[in]   status: Addon status code of the test mode.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _end_stream(sfx_u8 status) {
+    if (sigfox_ep_addon_rfp_api_ctx.test_mode_fn == SIGFOX_NULL) {
+        return;
+    }
+    SIGFOX_RFP_STREAM_end(SIGFOX_EP_ADDON_RFP_API_get_test_mode_progress_status(), status);
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void _end_timing(void)
+ * \brief Record the end time of the running test mode.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _end_timing(void) {
+    if ((sigfox_ep_addon_rfp_api_ctx.test_mode_running == SIGFOX_TRUE) && (sigfox_ep_addon_rfp_api_ctx.get_time_ms != SIGFOX_NULL)) {
+        sigfox_ep_addon_rfp_api_ctx.end_time_ms = sigfox_ep_addon_rfp_api_ctx.get_time_ms();
+    }
+    sigfox_ep_addon_rfp_api_ctx.test_mode_running = SIGFOX_FALSE;
+}
+#endif
+
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+/*!******************************************************************
+ * \fn static void _end_abort(void)
+ * \brief Report the end of an aborted test mode once the EP library is released.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _end_abort(void) {
+#if (defined SIGFOX_EP_ADDON_RFP_RESULT_STREAM) && (defined SIGFOX_EP_ERROR_CODES)
+    // Local variables.
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    sfx_u8 stream_status = (sfx_u8) SIGFOX_EP_ADDON_RFP_API_ERROR_ABORTED;
+#else
+    sfx_u8 stream_status = (sfx_u8) SIGFOX_EP_ADDON_RFP_API_ERROR_STEP_TIMEOUT;
+#endif
+#endif
+    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_READY;
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    // Release the grace period given to the message dropped on a step deadline.
+    SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_ID_STEP_DEADLINE);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#ifdef SIGFOX_EP_ERROR_CODES
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    if (sigfox_ep_addon_rfp_api_ctx.step_timeout == SIGFOX_TRUE) {
+        stream_status = (sfx_u8) SIGFOX_EP_ADDON_RFP_API_ERROR_STEP_TIMEOUT;
+    }
+#endif
+    _end_stream(stream_status);
+#else
+    _end_stream(SIGFOX_EP_ADDON_RFP_STREAM_STATUS_ERROR);
+#endif
+#endif
+    if (sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb != SIGFOX_NULL) {
+        sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb();
+    }
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _restart_ep_api(void)
+ * \brief Close and open the EP library again to release a message it never completed.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_API_status_t _restart_ep_api(void) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+#endif
+    // The completion of the stalled message can not be received anymore.
+    SIGFOX_RFP_COMMON_reset_message();
+#ifdef SIGFOX_EP_ERROR_CODES
+    sigfox_ep_api_status = SIGFOX_EP_API_close();
+    SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
+    sigfox_ep_api_status = SIGFOX_EP_API_open(&(sigfox_ep_addon_rfp_api_ctx.ep_api_config));
+    SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
+errors:
+#else
+    SIGFOX_EP_API_close();
+    SIGFOX_EP_API_open(&(sigfox_ep_addon_rfp_api_ctx.ep_api_config));
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+/*** SIGFOX EP API functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_open(SIGFOX_EP_ADDON_RFP_API_config_t *config)
+ * \brief Open the RFP addon.
+ * \param[in]   config: Pointer to the rfp addon configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_open(SIGFOX_EP_ADDON_RFP_API_config_t *config) {
+    // Local variables.
+    SIGFOX_EP_API_config_t ep_api_config;
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+#endif
+    // Check RFP ADDON state.
+    _CHECK_RFP_STATE(!= SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+#if (defined SIGFOX_EP_PARAMETERS_CHECK) && (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+    // The timer wheel needs a time source.
+    if (config->get_time_ms == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+#if (defined SIGFOX_EP_PARAMETERS_CHECK) && ((defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS))
+    // The throughput, carrier sense, soak, uplink timing and test mode E gap measurements need a time source.
+    if (config->get_time_ms == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+#if (defined SIGFOX_EP_PARAMETERS_CHECK) && (defined SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET)
+    // The execution budget needs a time source.
+    if (config->get_time_us == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+#if (defined SIGFOX_EP_PARAMETERS_CHECK) && (defined SIGFOX_EP_ADDON_RFP_CHECKPOINT)
+    // Checkpoints need a storage.
+    if ((config->checkpoint_period != 0) && (config->checkpoint_write == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Open EP library.
+    ep_api_config.rc = config->rc;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    ep_api_config.process_cb = &_SIGFOX_EP_API_process_callback;
+#endif
+#ifndef SIGFOX_EP_MESSAGE_COUNTER_ROLLOVER
+    ep_api_config.message_counter_rollover = config->message_counter_rollover;
+#endif
+    // Open library.
+#ifdef SIGFOX_EP_ERROR_CODES
+    sigfox_ep_api_status = SIGFOX_EP_API_open(&ep_api_config);
+    SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
+#else
+    SIGFOX_EP_API_open(&ep_api_config);
+#endif
+    // Store and configure parameters into static context if no error occurred.
+    sigfox_ep_addon_rfp_api_ctx.rc = config->rc;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_api_ctx.process_cb = config->process_cb;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    sigfox_ep_addon_rfp_api_ctx.get_time_ms = config->get_time_ms;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    sigfox_ep_addon_rfp_api_ctx.energy_model = config->energy_model;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL) && (defined SIGFOX_EP_ASYNCHRONOUS)
+    SIGFOX_RFP_TIMER_init(config->get_time_ms, &_SIGFOX_RFP_TIMER_process_callback);
+#elif (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+    SIGFOX_RFP_TIMER_init(config->get_time_ms);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    sigfox_ep_addon_rfp_api_ctx.get_time_us = config->get_time_us;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    sigfox_ep_addon_rfp_api_ctx.checkpoint_write = config->checkpoint_write;
+    sigfox_ep_addon_rfp_api_ctx.checkpoint_read = config->checkpoint_read;
+    sigfox_ep_addon_rfp_api_ctx.checkpoint_period = config->checkpoint_period;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    sigfox_ep_addon_rfp_api_ctx.stream_write = config->stream_write;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    // The EP library configuration is kept to restart it when a message is never completed.
+    sigfox_ep_addon_rfp_api_ctx.step_deadline_margin_ms = config->step_deadline_margin_ms;
+    sigfox_ep_addon_rfp_api_ctx.ep_api_config = ep_api_config;
+    SIGFOX_RFP_COMMON_set_step_deadline(config->step_deadline_margin_ms, &_SIGFOX_RFP_COMMON_deadline_callback);
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    SIGFOX_RFP_COMMON_reset_message();
+#endif
+    // Update ADDON RFP state if no error occurred.
+    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_READY;
+errors:
+#ifdef SIGFOX_EP_ERROR_CODES
+    return status;
+#else
+    return;
+#endif
+}
+
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_close(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+    // Release the addon timer.
+#ifdef SIGFOX_EP_ERROR_CODES
+    mcu_api_status = SIGFOX_RFP_TIMER_stop_all();
+    MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+#else
+    SIGFOX_RFP_TIMER_stop_all();
+#endif
+#endif
+    // Close EP library.
+#ifdef SIGFOX_EP_ERROR_CODES
+    sigfox_ep_api_status = SIGFOX_EP_API_close();
+    SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
+#else
+    SIGFOX_EP_API_close();
+#endif
+    // Reset parameters into static context
+    sigfox_ep_addon_rfp_api_ctx.rc = SIGFOX_NULL;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_api_ctx.process_cb = SIGFOX_NULL;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT) || (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) || (defined SIGFOX_EP_ADDON_RFP_SOAK) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING) || (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS)
+    sigfox_ep_addon_rfp_api_ctx.get_time_ms = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    sigfox_ep_addon_rfp_api_ctx.energy_model = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    sigfox_ep_addon_rfp_api_ctx.get_time_us = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    sigfox_ep_addon_rfp_api_ctx.checkpoint_write = SIGFOX_NULL;
+    sigfox_ep_addon_rfp_api_ctx.checkpoint_read = SIGFOX_NULL;
+    sigfox_ep_addon_rfp_api_ctx.checkpoint_period = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    sigfox_ep_addon_rfp_api_ctx.stream_write = SIGFOX_NULL;
+#endif
+    // Update ADDON RFP state if no error occurred.
+    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE;
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+/*!******************************************************************
+ * \fn static sfx_bool _is_budget_left(sfx_u32 start_us, sfx_u32 max_us, sfx_bool *yielded)
+ * \brief Check if the execution budget of the process function allows another pass on the events.
+ * \param[in]   start_us: Time at which the process function was called.
+ * \param[in]   max_us: Execution budget.
+ * \param[out]  yielded: Set to SIGFOX_TRUE when the budget is exhausted. SIGFOX_NULL for an unlimited budget.
+ * \retval      SIGFOX_TRUE if another pass can be done, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+static sfx_bool _is_budget_left(sfx_u32 start_us, sfx_u32 max_us, sfx_bool *yielded) {
+    if (yielded == SIGFOX_NULL) {
+        return SIGFOX_TRUE;
+    }
+    if ((sigfox_ep_addon_rfp_api_ctx.get_time_us() - start_us) < max_us) {
+        return SIGFOX_TRUE;
+    }
+    (*yielded) = SIGFOX_TRUE;
+    return SIGFOX_FALSE;
+}
+#endif
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _process(sfx_u32 max_us, sfx_bool *yielded)
+ * \brief Handle the events raised before or during the call, so that the process callback is triggered once per batch of events.
+ * \brief With an execution budget, the events left when the budget is exhausted trigger the process callback again.
+ * \param[in]   max_us: Execution budget (budget builds only).
+ * \param[out]  yielded: Set to SIGFOX_TRUE when events are left (budget builds only). SIGFOX_NULL for an unlimited budget.
+ * \retval      Function execution status.
+ *******************************************************************/
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+static SIGFOX_EP_ADDON_RFP_API_status_t _process(sfx_u32 max_us, sfx_bool *yielded) {
+#else
+static SIGFOX_EP_ADDON_RFP_API_status_t _process(void) {
+#endif
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    sfx_u32 start_us = 0;
+    // The clock is only available between open and close: run without budget otherwise.
+    if (sigfox_ep_addon_rfp_api_ctx.get_time_us == SIGFOX_NULL) {
+        yielded = SIGFOX_NULL;
+    }
+    if (yielded != SIGFOX_NULL) {
+        start_us = sigfox_ep_addon_rfp_api_ctx.get_time_us();
+    }
+#endif
+    // Handle all the events raised before or during this call.
+    do {
+        if (sigfox_ep_addon_rfp_api_ctx.flags.ep_api_process == 1) {
+            _SET_FLAG(ep_api_process, 0);
+#ifdef SIGFOX_EP_ERROR_CODES
+            sigfox_ep_api_status = SIGFOX_EP_API_process();
+            SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
+#else
+            SIGFOX_EP_API_process();
+#endif
+        }
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+        if (sigfox_ep_addon_rfp_api_ctx.flags.rfp_timer_process == 1) {
+            _SET_FLAG(rfp_timer_process, 0);
+#ifdef SIGFOX_EP_ERROR_CODES
+            mcu_api_status = SIGFOX_RFP_TIMER_process();
+            MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+#else
+            SIGFOX_RFP_TIMER_process();
+#endif
+        }
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+        if (sigfox_ep_addon_rfp_api_ctx.flags.rfp_step_timeout == 1) {
+            _SET_FLAG(rfp_step_timeout, 0);
+            if (sigfox_ep_addon_rfp_api_ctx.state == SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS) {
+                // The EP library did not complete the message: abort the test mode as the abort function does.
+                sigfox_ep_addon_rfp_api_ctx.step_timeout = SIGFOX_TRUE;
+                sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_ABORT;
+                _SET_FLAG(rfp_test_mode_process, 0);
+                _SET_FLAG(rfp_test_mode_cplt, 0);
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+                SIGFOX_RFP_ENERGY_stop_window();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+                _end_timing();
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+                mcu_api_status = SIGFOX_RFP_TIMER_stop_all();
+                MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+#else
+                SIGFOX_RFP_TIMER_stop_all();
+#endif
+                if (SIGFOX_RFP_COMMON_drop_message(&_SIGFOX_RFP_TEST_MODE_process_callback) == SIGFOX_FALSE) {
+                    _end_abort();
+                }
+                else {
+                    // The dropped message is given one more margin to complete before the EP library is restarted.
+#ifdef SIGFOX_EP_ERROR_CODES
+                    mcu_api_status = SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_ID_STEP_DEADLINE, sigfox_ep_addon_rfp_api_ctx.step_deadline_margin_ms, &_SIGFOX_RFP_COMMON_deadline_callback);
+                    MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+#else
+                    SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_ID_STEP_DEADLINE, sigfox_ep_addon_rfp_api_ctx.step_deadline_margin_ms, &_SIGFOX_RFP_COMMON_deadline_callback);
+#endif
+                }
+                SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STEP_TIMEOUT);
+            }
+            if ((sigfox_ep_addon_rfp_api_ctx.state == SIGFOX_EP_ADDON_RFP_API_STATE_ABORT) && (sigfox_ep_addon_rfp_api_ctx.step_timeout == SIGFOX_TRUE) && (SIGFOX_RFP_COMMON_is_message_pending() == SIGFOX_TRUE)) {
+                // The EP library can not complete the drop: restart it to release the message.
+#ifdef SIGFOX_EP_ERROR_CODES
+                status = _restart_ep_api();
+                if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+                    _end_abort();
+                    goto errors;
+                }
+#else
+                _restart_ep_api();
+#endif
+                _end_abort();
+            }
+        }
+#endif
+        switch (sigfox_ep_addon_rfp_api_ctx.state) {
+        case SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE:
+        case SIGFOX_EP_ADDON_RFP_API_STATE_READY:
+            // No test mode running.
+            _SET_FLAG(rfp_test_mode_process, 0);
+            _SET_FLAG(rfp_test_mode_cplt, 0);
+            break;
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+        case SIGFOX_EP_ADDON_RFP_API_STATE_ABORT:
+            _SET_FLAG(rfp_test_mode_process, 0);
+            _SET_FLAG(rfp_test_mode_cplt, 0);
+            // The abort is completed once the EP library is released.
+            if (SIGFOX_RFP_COMMON_is_message_pending() == SIGFOX_FALSE) {
+                _end_abort();
+            }
+            break;
+#endif
+        case SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS:
+            if (sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_process == 1) {
+                _SET_FLAG(rfp_test_mode_process, 0);
+                if (sigfox_ep_addon_rfp_api_ctx.test_mode_fn != SIGFOX_NULL) {
+#ifdef SIGFOX_EP_ERROR_CODES
+                    status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
+                    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+#else
+                    sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
+#endif
+                }
+            }
+            if (sigfox_ep_addon_rfp_api_ctx.flags.rfp_test_mode_cplt == 1) {
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+                SIGFOX_RFP_ENERGY_stop_window();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+                _end_timing();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+                _end_checkpoint();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                _end_stream(SIGFOX_EP_ADDON_RFP_STREAM_STATUS_SUCCESS);
+#endif
+                if (sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb != SIGFOX_NULL) {
+                    sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb();
+                }
+                _SET_FLAG(rfp_test_mode_cplt, 0);
+                sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_READY;
+            }
+            break;
+        default:
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+        }
+    }
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+    while (((sigfox_ep_addon_rfp_api_ctx.flags.all & SIGFOX_EP_ADDON_RFP_API_EVENT_FLAGS_MASK) != 0) && (_is_budget_left(start_us, max_us, yielded) == SIGFOX_TRUE));
+#else
+    while ((sigfox_ep_addon_rfp_api_ctx.flags.all & SIGFOX_EP_ADDON_RFP_API_EVENT_FLAGS_MASK) != 0);
+#endif
+    _end_process();
+    SIGFOX_RETURN();
+errors:
+    // Only a running test mode is ended by an error, the EP library can also fail while the addon is idle.
+    if (sigfox_ep_addon_rfp_api_ctx.state == SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS) {
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+        _end_timing();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+        _end_stream(_STREAM_ERROR_STATUS);
+#endif
+        if (sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb != SIGFOX_NULL) {
+            sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb();
+        }
+        sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_READY;
+    }
+    _end_process();
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process(void)
+ * \brief Main process function of the RFP addon.
+ * \brief In asynchronous mode, this function is called by the client when the process callback is triggered.
+ * \brief All the events raised before or during the call are handled, so that the process callback is triggered once per batch of events.
+ * \brief In blocking mode, this function is called by the library itself until the requested operation is completed.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process(void) {
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+#ifdef SIGFOX_EP_ERROR_CODES
+    return _process(0, SIGFOX_NULL);
+#else
+    _process(0, SIGFOX_NULL);
+#endif
+#else
+#ifdef SIGFOX_EP_ERROR_CODES
+    return _process();
+#else
+    _process();
+#endif
+#endif
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_PROCESS_BUDGET
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process_budget(sfx_u32 max_us, sfx_bool *yielded)
+ * \brief Process function of the RFP addon with an execution budget.
+ * \brief The events are handled until none is left or the budget is exhausted. In the latter case, the process callback is triggered again.
+ * \param[in]   max_us: Execution budget in microseconds.
+ * \param[out]  yielded: Set to SIGFOX_TRUE if events are left when the function returns.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_process_budget(sfx_u32 max_us, sfx_bool *yielded) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (yielded == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    (*yielded) = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _process(max_us, yielded);
+#else
+    _process(max_us, yielded);
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_EP_ADDON_RFP_API_is_process_pending(void)
+ * \brief Indicate if the process function has to be called.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if events are waiting to be processed, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_EP_ADDON_RFP_API_is_process_pending(void) {
+    return (sigfox_ep_addon_rfp_api_ctx.process_pending == 0) ? SIGFOX_FALSE : SIGFOX_TRUE;
+}
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode)
+ * \brief Execute a specific test mode for RF & Protocol test.
+ * \param[in]   test_mode: Pointer to the test_mode data.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    SIGFOX_RFP_test_mode_t rfp_test_mode;
+    // Check RFP ADDON is opened.
+    _CHECK_RFP_STATE(!= SIGFOX_EP_ADDON_RFP_API_STATE_READY);
+#if (defined SIGFOX_EP_ADDON_RFP_EARLY_STOP) && (defined SIGFOX_EP_PARAMETERS_CHECK)
+    if ((test_mode->early_stop_threshold_percent >= 100) || (test_mode->early_stop_confidence >= SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_LAST)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE);
+    }
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_LBT_PROFILER) && (defined SIGFOX_EP_PARAMETERS_CHECK)
+    if (test_mode->lbt_profile != SIGFOX_NULL) {
+        if (((test_mode->lbt_profile)->channel_list_hz == SIGFOX_NULL) || ((test_mode->lbt_profile)->stats_table == SIGFOX_NULL)) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+        }
+        // The total number of messages is counted on 16 bits.
+        if (((test_mode->lbt_profile)->number_of_channels == 0) || ((test_mode->lbt_profile)->number_of_cs_steps == 0) || ((test_mode->lbt_profile)->number_of_messages == 0) ||
+            (((sfx_u32) (test_mode->lbt_profile)->number_of_channels * (test_mode->lbt_profile)->number_of_cs_steps * (test_mode->lbt_profile)->number_of_messages) > 0xFFFF)) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE);
+        }
+    }
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_RX_SCAN) && (defined SIGFOX_EP_PARAMETERS_CHECK)
+    if (test_mode->rx_scan != SIGFOX_NULL) {
+        if (((test_mode->rx_scan)->frequency_list_hz == SIGFOX_NULL) || ((test_mode->rx_scan)->stats_table == SIGFOX_NULL)) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+        }
+        if ((test_mode->rx_scan)->number_of_frequencies == 0) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE);
+        }
+    }
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_SOAK) && (defined SIGFOX_EP_PARAMETERS_CHECK)
+    // Only the test modes B and J can be repeated.
+    if ((test_mode->soak == SIGFOX_TRUE) && (test_mode->test_mode_reference != SIGFOX_EP_ADDON_RFP_API_TEST_MODE_B) && (test_mode->test_mode_reference != SIGFOX_EP_ADDON_RFP_API_TEST_MODE_J)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE);
+    }
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_SINGLE_PASS) && (defined SIGFOX_EP_PARAMETERS_CHECK)
+    // Only the test mode E has an uplink followed by a listening window.
+    if ((test_mode->single_pass == SIGFOX_TRUE) && (test_mode->test_mode_reference != SIGFOX_EP_ADDON_RFP_API_TEST_MODE_E)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE);
+    }
+#endif
+    sigfox_ep_addon_rfp_api_ctx.test_mode_fn = _get_test_mode_fn(test_mode->test_mode_reference);
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    _SET_FLAG(rfp_test_mode_process, 0);
+    _SET_FLAG(rfp_test_mode_cplt, 0);
+    sigfox_ep_addon_rfp_api_ctx.test_mode_cplt_cb = test_mode->test_mode_cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    _SET_FLAG(rfp_step_timeout, 0);
+    sigfox_ep_addon_rfp_api_ctx.step_timeout = SIGFOX_FALSE;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    sigfox_ep_addon_rfp_api_ctx.aborted = SIGFOX_FALSE;
+#endif
+    _set_rfp_test_mode(test_mode, &rfp_test_mode);
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    sigfox_ep_addon_rfp_api_ctx.checkpoint.test_mode_reference = (sfx_u8) test_mode->test_mode_reference;
+    if (sigfox_ep_addon_rfp_api_ctx.resume == SIGFOX_TRUE) {
+        rfp_test_mode.start_step = sigfox_ep_addon_rfp_api_ctx.checkpoint.step;
+        rfp_test_mode.start_state = sigfox_ep_addon_rfp_api_ctx.checkpoint.state;
+    }
+#endif
+    if (sigfox_ep_addon_rfp_api_ctx.test_mode_fn == SIGFOX_NULL)
+#ifdef SIGFOX_EP_ERROR_CODES
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE)
+#else
+        goto errors;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    SIGFOX_RFP_ENERGY_reset(sigfox_ep_addon_rfp_api_ctx.energy_model);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    SIGFOX_RFP_THROUGHPUT_reset(sigfox_ep_addon_rfp_api_ctx.get_time_ms);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    SIGFOX_RFP_SOAK_reset(sigfox_ep_addon_rfp_api_ctx.get_time_ms);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+    SIGFOX_RFP_VOLTAGE_TEMPERATURE_reset(test_mode->voltage_temperature);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+    SIGFOX_RFP_UPLINK_TIMING_reset(sigfox_ep_addon_rfp_api_ctx.get_time_ms);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    SIGFOX_RFP_STREAM_start(sigfox_ep_addon_rfp_api_ctx.stream_write, (sfx_u8) test_mode->test_mode_reference);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    sigfox_ep_addon_rfp_api_ctx.test_mode_fn->plan_fn(&rfp_test_mode, &(sigfox_ep_addon_rfp_api_ctx.plan));
+    sigfox_ep_addon_rfp_api_ctx.start_time_ms = (sigfox_ep_addon_rfp_api_ctx.get_time_ms != SIGFOX_NULL) ? sigfox_ep_addon_rfp_api_ctx.get_time_ms() : 0;
+    sigfox_ep_addon_rfp_api_ctx.end_time_ms = sigfox_ep_addon_rfp_api_ctx.start_time_ms;
+    sigfox_ep_addon_rfp_api_ctx.test_mode_running = SIGFOX_TRUE;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->init_fn(&rfp_test_mode);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+#else
+    sigfox_ep_addon_rfp_api_ctx.test_mode_fn->init_fn(&rfp_test_mode);
+#endif
+
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+#else
+    sigfox_ep_addon_rfp_api_ctx.test_mode_fn->process_fn();
+#endif
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS;
+    if (sigfox_ep_addon_rfp_api_ctx.process_cb == SIGFOX_NULL) {
+        // Block until library goes back to READY state.
+        while (sigfox_ep_addon_rfp_api_ctx.state != SIGFOX_EP_ADDON_RFP_API_STATE_READY) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = SIGFOX_EP_ADDON_RFP_API_process();
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+#else // SIGFOX_EP_ERROR_CODES
+            SIGFOX_EP_API_process();
+#endif
+        }
+    }
+#else // SYNCHRONOUS
+
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_ENERGY) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+    SIGFOX_RFP_ENERGY_stop_window();
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+    _end_timing();
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_CHECKPOINT) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+    _end_checkpoint();
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_RESULT_STREAM) && !(defined SIGFOX_EP_ASYNCHRONOUS)
+    _end_stream(SIGFOX_EP_ADDON_RFP_STREAM_STATUS_SUCCESS);
+#endif
+    SIGFOX_RETURN();
+errors:
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_RESULT_STREAM)
+    // The timing and stream of a test mode already running in the background are left untouched.
+    if (sigfox_ep_addon_rfp_api_ctx.state == SIGFOX_EP_ADDON_RFP_API_STATE_READY) {
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+        _end_timing();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+        _end_stream(_STREAM_ERROR_STATUS);
+#endif
+    }
+#endif
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_resume_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode)
+ * \brief Execute a test mode from the last checkpoint.
+ * \param[in]   test_mode: Pointer to the test_mode data.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_resume_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_RFP_API_checkpoint_t checkpoint;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if ((test_mode == SIGFOX_NULL) || (sigfox_ep_addon_rfp_api_ctx.checkpoint_read == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // A checkpoint of another test mode is ignored.
+    if ((sigfox_ep_addon_rfp_api_ctx.checkpoint_read(&checkpoint) == SIGFOX_TRUE) && (checkpoint.test_mode_reference == (sfx_u8) test_mode->test_mode_reference)) {
+        sigfox_ep_addon_rfp_api_ctx.checkpoint.step = checkpoint.step;
+        sigfox_ep_addon_rfp_api_ctx.checkpoint.state = checkpoint.state;
+        sigfox_ep_addon_rfp_api_ctx.resume = SIGFOX_TRUE;
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_test_mode(test_mode);
+#else
+    SIGFOX_EP_ADDON_RFP_API_test_mode(test_mode);
+#endif
+    sigfox_ep_addon_rfp_api_ctx.resume = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
 #endif
     SIGFOX_RETURN();
+}
+#endif
+
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_abort_test_mode(void)
+ * \brief Abort the running test mode.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_abort_test_mode(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+    _CHECK_RFP_STATE(!= SIGFOX_EP_ADDON_RFP_API_STATE_PROCESS);
+    // The pending events of the test mode are dropped by the process function in ABORT state.
+    sigfox_ep_addon_rfp_api_ctx.aborted = SIGFOX_TRUE;
+    sigfox_ep_addon_rfp_api_ctx.state = SIGFOX_EP_ADDON_RFP_API_STATE_ABORT;
+    _SET_FLAG(rfp_test_mode_process, 0);
+    _SET_FLAG(rfp_test_mode_cplt, 0);
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    _SET_FLAG(rfp_step_timeout, 0);
+#endif
+    // Release the addon timers.
+#ifdef SIGFOX_EP_ERROR_CODES
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+    mcu_api_status = SIGFOX_RFP_TIMER_stop_all();
+#else
+    mcu_api_status = SIGFOX_RFP_COMMON_timer_stop();
+#endif
+#else
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+    SIGFOX_RFP_TIMER_stop_all();
+#else
+    SIGFOX_RFP_COMMON_timer_stop();
+#endif
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    SIGFOX_RFP_ENERGY_stop_window();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    _end_timing();
+#endif
+    // A message in progress can not be interrupted: its completion is discarded and ends the abort.
+    if (SIGFOX_RFP_COMMON_drop_message(&_SIGFOX_RFP_TEST_MODE_process_callback) == SIGFOX_FALSE) {
+        _end_abort();
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+#endif
 errors:
     SIGFOX_RETURN();
 }
+#endif
 
 /*!******************************************************************
  * \fn SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_progress_status(void)
@@ -410,9 +1358,326 @@ SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_
     if (sigfox_ep_addon_rfp_api_ctx.test_mode_fn->get_progress_status_fn != SIGFOX_NULL) {
         progress_status = sigfox_ep_addon_rfp_api_ctx.test_mode_fn->get_progress_status_fn();
     }
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    // A test mode aborted on a step deadline never reaches 100%.
+    if (sigfox_ep_addon_rfp_api_ctx.step_timeout == SIGFOX_TRUE) {
+        progress_status.status.error = 1;
+    }
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_COMMAND) || (defined SIGFOX_EP_ADDON_RFP_SOAK)
+    if (sigfox_ep_addon_rfp_api_ctx.aborted == SIGFOX_TRUE) {
+        progress_status.status.error = 1;
+    }
+#endif
     return progress_status;
 }
 
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_plan_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of a test mode without running it.
+ * \param[in]   test_mode: Pointer to the test_mode data.
+ * \param[out]  plan: Pointer to the plan to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_plan_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    const SIGFOX_RFP_test_mode_fn_t *test_mode_fn = SIGFOX_NULL;
+    SIGFOX_RFP_test_mode_t rfp_test_mode;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if ((test_mode == SIGFOX_NULL) || (plan == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    test_mode_fn = _get_test_mode_fn(test_mode->test_mode_reference);
+    if (test_mode_fn == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TEST_MODE);
+    }
+    _set_rfp_test_mode(test_mode, &rfp_test_mode);
+    test_mode_fn->plan_fn(&rfp_test_mode, plan);
+errors:
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_timing(SIGFOX_EP_ADDON_RFP_API_test_mode_timing_t *timing)
+ * \brief Get the planned, elapsed and remaining time of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  timing: Pointer to the timing to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_test_mode_timing(SIGFOX_EP_ADDON_RFP_API_test_mode_timing_t *timing) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    sfx_u32 now_ms = sigfox_ep_addon_rfp_api_ctx.end_time_ms;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (timing == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    if ((sigfox_ep_addon_rfp_api_ctx.test_mode_running == SIGFOX_TRUE) && (sigfox_ep_addon_rfp_api_ctx.get_time_ms != SIGFOX_NULL)) {
+        now_ms = sigfox_ep_addon_rfp_api_ctx.get_time_ms();
+    }
+    timing->planned_ms = sigfox_ep_addon_rfp_api_ctx.plan.duration_ms;
+    timing->elapsed_ms = now_ms - sigfox_ep_addon_rfp_api_ctx.start_time_ms;
+    timing->remaining_ms = (timing->elapsed_ms < timing->planned_ms) ? (timing->planned_ms - timing->elapsed_ms) : 0;
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_energy_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report)
+ * \brief Get the energy accounting of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  energy_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_energy_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (energy_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    SIGFOX_RFP_ENERGY_get_report(energy_report);
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_early_stop_report(SIGFOX_EP_ADDON_RFP_API_early_stop_report_t *early_stop_report)
+ * \brief Get the downlink counts and the early stop verdict of the running or last test mode E.
+ * \param[in]   none
+ * \param[out]  early_stop_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_early_stop_report(SIGFOX_EP_ADDON_RFP_API_early_stop_report_t *early_stop_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (early_stop_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    (*early_stop_report) = sigfox_ep_addon_rfp_api_ctx.early_stop_report;
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_throughput_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report)
+ * \brief Get the achieved frame rate and the added latency of the running or last test mode B or J.
+ * \param[in]   none
+ * \param[out]  throughput_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_throughput_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (throughput_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    SIGFOX_RFP_THROUGHPUT_get_report(throughput_report);
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_public_key_report(SIGFOX_EP_ADDON_RFP_API_public_key_report_t *public_key_report)
+ * \brief Get the messages sent with the public key by the running or last test mode K and the result of each frame.
+ * \param[in]   none
+ * \param[out]  public_key_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_public_key_report(SIGFOX_EP_ADDON_RFP_API_public_key_report_t *public_key_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (public_key_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    (*public_key_report) = sigfox_ep_addon_rfp_api_ctx.public_key_report;
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_API_add_nvm_write(sfx_u32 write_time_us)
+ * \brief Report one NVM write. To be called by the MCU_API_set_nvm() implementation with its own measured duration.
+ * \param[in]   write_time_us: Duration of the write.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_API_add_nvm_write(sfx_u32 write_time_us) {
+    SIGFOX_RFP_NVM_add_write(write_time_us);
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_nvm_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report)
+ * \brief Get the NVM write statistics and the message counter consistency of the running or last test mode L.
+ * \param[in]   none
+ * \param[out]  nvm_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_nvm_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (nvm_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    SIGFOX_RFP_NVM_get_report(nvm_report);
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_soak_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report)
+ * \brief Get the rolling statistics of the running or last test mode B or J, without stopping it.
+ * \param[in]   none
+ * \param[out]  soak_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_soak_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (soak_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    SIGFOX_RFP_SOAK_get_report(soak_report);
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_voltage_temperature_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report)
+ * \brief Get the supply voltage and temperature summary of the running or last test mode.
+ * \param[in]   none
+ * \param[out]  voltage_temperature_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_voltage_temperature_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (voltage_temperature_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    SIGFOX_RFP_VOLTAGE_TEMPERATURE_get_report(voltage_temperature_report);
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_uplink_timing_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report)
+ * \brief Get the uplink and downlink phase durations of the running or last test mode.
+ * \param[in]   none
+ * \param[out]  uplink_timing_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_uplink_timing_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (uplink_timing_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    SIGFOX_RFP_UPLINK_TIMING_get_report(uplink_timing_report);
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_single_pass_report(SIGFOX_EP_ADDON_RFP_API_single_pass_report_t *single_pass_report)
+ * \brief Get the gap between the uplink and the listening window of the running or last test mode E.
+ * \param[in]   none
+ * \param[out]  single_pass_report: Pointer to the report to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_single_pass_report(SIGFOX_EP_ADDON_RFP_API_single_pass_report_t *single_pass_report) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (single_pass_report == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Check library is opened.
+    _CHECK_RFP_STATE(== SIGFOX_EP_ADDON_RFP_API_STATE_CLOSE);
+    (*single_pass_report) = sigfox_ep_addon_rfp_api_ctx.single_pass_report;
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
 #ifdef SIGFOX_EP_VERBOSE
 /*!******************************************************************
  * \fn SIGFOX_EP_API_status_t SIGFOX_EP_ADDON_RFP_API_get_version(sfx_u8 **version, sfx_u8 *version_size_char)
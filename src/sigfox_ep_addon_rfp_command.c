@@ -0,0 +1,551 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_command.c
+ * \brief   Sigfox addon RF & Protocol command front-end
+ * \details This file drives the asynchronous addon from a binary command protocol received on any byte transport.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include "sigfox_ep_addon_rfp_command.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_error.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_COMMAND)
+
+#if (SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES < 2) || (SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES > 255)
+#error "SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES must be between 2 and 255"
+#endif
+
+/*** SIGFOX EP ADDON RFP COMMAND local macros ***/
+
+/*!******************************************************************
+ * \fn sfx_u8 _REPLY_STATUS(status)
+ * \brief Reply status of an addon call.
+ *******************************************************************/
+#ifdef SIGFOX_EP_ERROR_CODES
+#define _REPLY_STATUS(status)   ((sfx_u8) (status))
+#else
+#define _REPLY_STATUS(status)   SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS
+#endif
+
+/*** SIGFOX EP ADDON RFP COMMAND local structures ***/
+
+typedef struct {
+    const SIGFOX_EP_ADDON_RFP_COMMAND_config_t *config;
+    // Reception buffer: the write index is only updated by the reception IRQ, the read index by the process function.
+    sfx_u8 rx_buffer[SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES];
+    volatile sfx_u8 rx_write_idx;
+    volatile sfx_u8 rx_read_idx;
+    volatile sfx_bool rx_overflow;
+    volatile sfx_bool process_pending;
+    // Command frame parser.
+    sfx_u8 header[SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES];
+    sfx_u8 value[SIGFOX_EP_ADDON_RFP_COMMAND_VALUE_SIZE_MAX_BYTES];
+    sfx_u16 frame_idx;
+    // Addon state seen by the host.
+    sfx_bool opened;
+    sfx_bool running;
+    sfx_bool test_mode_started;
+    sfx_bool test_mode_cplt;
+    sfx_u8 test_mode_reference;
+} SIGFOX_EP_ADDON_RFP_COMMAND_context_t;
+
+/*** SIGFOX EP ADDON RFP COMMAND local global variables ***/
+
+static SIGFOX_EP_ADDON_RFP_COMMAND_context_t sigfox_ep_addon_rfp_command_ctx = {
+    .config = SIGFOX_NULL,
+    .rx_write_idx = 0,
+    .rx_read_idx = 0,
+    .rx_overflow = SIGFOX_FALSE,
+    .process_pending = SIGFOX_FALSE,
+    .frame_idx = 0,
+    .opened = SIGFOX_FALSE,
+    .running = SIGFOX_FALSE,
+    .test_mode_started = SIGFOX_FALSE,
+    .test_mode_cplt = SIGFOX_FALSE,
+    .test_mode_reference = 0,
+};
+
+/*** SIGFOX EP ADDON RFP COMMAND local functions ***/
+
+/*!******************************************************************
+ * \fn static void _notify_process(void)
+ * \brief Call the process callback if not already done since the last process function call.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _notify_process(void) {
+    // Call the process callback once per batch of events.
+    if (sigfox_ep_addon_rfp_command_ctx.process_pending == SIGFOX_FALSE) {
+        sigfox_ep_addon_rfp_command_ctx.process_pending = SIGFOX_TRUE;
+        sigfox_ep_addon_rfp_command_ctx.config->process_cb();
+    }
+}
+
+/*!******************************************************************
+ * \fn static void _test_mode_cplt_cb(void)
+ * \brief Test mode completion callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _test_mode_cplt_cb(void) {
+    // The event is sent by the process function.
+    sigfox_ep_addon_rfp_command_ctx.running = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_command_ctx.test_mode_cplt = SIGFOX_TRUE;
+    if ((sigfox_ep_addon_rfp_command_ctx.config->test_mode)->test_mode_cplt_cb != SIGFOX_NULL) {
+        (sigfox_ep_addon_rfp_command_ctx.config->test_mode)->test_mode_cplt_cb();
+    }
+}
+
+/*!******************************************************************
+ * \fn static sfx_u8 _get_progress(void)
+ * \brief Get the progress byte of the current test mode.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Progress with the error bit.
+ *******************************************************************/
+static sfx_u8 _get_progress(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
+    sfx_u8 progress = 0;
+    if (sigfox_ep_addon_rfp_command_ctx.test_mode_started == SIGFOX_TRUE) {
+        progress_status = SIGFOX_EP_ADDON_RFP_API_get_test_mode_progress_status();
+        progress = (sfx_u8) (progress_status.progress & SIGFOX_EP_ADDON_RFP_COMMAND_PROGRESS_MASK);
+        if (progress_status.status.error != 0) {
+            progress |= SIGFOX_EP_ADDON_RFP_COMMAND_PROGRESS_ERROR;
+        }
+    }
+    return progress;
+}
+
+/*!******************************************************************
+ * \fn static void _send(sfx_u8 identifier, sfx_u8 *value, sfx_u8 value_size_bytes)
+ * \brief Send a frame through the reply callback.
+ * \param[in]   identifier: Frame identifier.
+ * \param[in]   value: Frame value.
+ * \param[in]   value_size_bytes: Frame value size.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _send(sfx_u8 identifier, sfx_u8 *value, sfx_u8 value_size_bytes) {
+    // Local variables.
+    sfx_u8 frame[SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES + SIGFOX_EP_ADDON_RFP_COMMAND_REPLY_SIZE_MAX_BYTES];
+    sfx_u8 idx = 0;
+    frame[0] = identifier;
+    frame[1] = value_size_bytes;
+    for (idx = 0; idx < value_size_bytes; idx++) {
+        frame[SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES + idx] = value[idx];
+    }
+    sigfox_ep_addon_rfp_command_ctx.config->reply(frame, (sfx_u8) (SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES + value_size_bytes));
+}
+
+/*!******************************************************************
+ * \fn static sfx_u8 _open(void)
+ * \brief Execute the open command.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Command status.
+ *******************************************************************/
+static sfx_u8 _open(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    const SIGFOX_EP_ADDON_RFP_COMMAND_config_t *config = sigfox_ep_addon_rfp_command_ctx.config;
+    SIGFOX_EP_ADDON_RFP_API_config_t addon_config;
+    if (sigfox_ep_addon_rfp_command_ctx.opened == SIGFOX_TRUE) {
+        return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_STATE;
+    }
+    if (sigfox_ep_addon_rfp_command_ctx.value[0] >= config->number_of_rc) {
+        return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_PARAMETER;
+    }
+#ifndef SIGFOX_EP_MESSAGE_COUNTER_ROLLOVER
+    if (sigfox_ep_addon_rfp_command_ctx.value[1] >= SIGFOX_MESSAGE_COUNTER_ROLLOVER_LAST) {
+        return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_PARAMETER;
+    }
+#endif
+    addon_config = *(config->addon_config);
+    addon_config.rc = config->rc_table[sigfox_ep_addon_rfp_command_ctx.value[0]];
+#ifndef SIGFOX_EP_MESSAGE_COUNTER_ROLLOVER
+    addon_config.message_counter_rollover = (SIGFOX_message_counter_rollover_t) sigfox_ep_addon_rfp_command_ctx.value[1];
+#endif
+    addon_config.process_cb = &_notify_process;
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    // The stream records are sent on the reply transport, their tags do not overlap the reply identifiers.
+    if (addon_config.stream_write == SIGFOX_NULL) {
+        addon_config.stream_write = config->reply;
+    }
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_open(&addon_config);
+    if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+        return _REPLY_STATUS(status);
+    }
+#else
+    SIGFOX_EP_ADDON_RFP_API_open(&addon_config);
+#endif
+    sigfox_ep_addon_rfp_command_ctx.opened = SIGFOX_TRUE;
+    sigfox_ep_addon_rfp_command_ctx.running = SIGFOX_FALSE;
+    return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn static sfx_u8 _close(void)
+ * \brief Execute the close command.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Command status.
+ *******************************************************************/
+static sfx_u8 _close(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    if (sigfox_ep_addon_rfp_command_ctx.opened == SIGFOX_FALSE) {
+        return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_STATE;
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_close();
+    if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+        return _REPLY_STATUS(status);
+    }
+#else
+    SIGFOX_EP_ADDON_RFP_API_close();
+#endif
+    sigfox_ep_addon_rfp_command_ctx.opened = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_command_ctx.running = SIGFOX_FALSE;
+    return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn static sfx_u8 _test_mode(void)
+ * \brief Execute the test mode command.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Command status.
+ *******************************************************************/
+static sfx_u8 _test_mode(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    sfx_bool test_mode_started = sigfox_ep_addon_rfp_command_ctx.test_mode_started;
+    sfx_u8 test_mode_reference = sigfox_ep_addon_rfp_command_ctx.test_mode_reference;
+#endif
+    SIGFOX_EP_ADDON_RFP_API_test_mode_t test_mode;
+    if (sigfox_ep_addon_rfp_command_ctx.opened == SIGFOX_FALSE) {
+        return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_STATE;
+    }
+#ifndef SIGFOX_EP_UL_BIT_RATE_BPS
+    if (sigfox_ep_addon_rfp_command_ctx.value[1] >= SIGFOX_UL_BIT_RATE_LAST) {
+        return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_PARAMETER;
+    }
+#endif
+    test_mode = *(sigfox_ep_addon_rfp_command_ctx.config->test_mode);
+    test_mode.test_mode_reference = (SIGFOX_EP_ADDON_RFP_API_test_mode_reference_t) sigfox_ep_addon_rfp_command_ctx.value[0];
+#ifndef SIGFOX_EP_UL_BIT_RATE_BPS
+    test_mode.ul_bit_rate = (SIGFOX_ul_bit_rate_t) sigfox_ep_addon_rfp_command_ctx.value[1];
+#endif
+#ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
+    test_mode.tx_power_dbm_eirp = (sfx_s8) sigfox_ep_addon_rfp_command_ctx.value[2];
+#endif
+    test_mode.test_mode_cplt_cb = &_test_mode_cplt_cb;
+    sigfox_ep_addon_rfp_command_ctx.test_mode_reference = sigfox_ep_addon_rfp_command_ctx.value[0];
+    sigfox_ep_addon_rfp_command_ctx.test_mode_started = SIGFOX_TRUE;
+    sigfox_ep_addon_rfp_command_ctx.test_mode_cplt = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_command_ctx.running = SIGFOX_TRUE;
+    // The process callback is set, so the call returns as soon as the test mode is started.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_test_mode(&test_mode);
+    if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+        // A refused test mode does not replace the result of the previous one.
+        if (status == SIGFOX_EP_ADDON_RFP_API_ERROR_STATE) {
+            sigfox_ep_addon_rfp_command_ctx.test_mode_reference = test_mode_reference;
+            sigfox_ep_addon_rfp_command_ctx.test_mode_started = test_mode_started;
+        }
+        else {
+            sigfox_ep_addon_rfp_command_ctx.running = SIGFOX_FALSE;
+            sigfox_ep_addon_rfp_command_ctx.test_mode_started = SIGFOX_FALSE;
+        }
+        return _REPLY_STATUS(status);
+    }
+#else
+    SIGFOX_EP_ADDON_RFP_API_test_mode(&test_mode);
+#endif
+    return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+}
+
+/*!******************************************************************
+ * \fn static sfx_u8 _abort(void)
+ * \brief Execute the abort command.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Command status.
+ *******************************************************************/
+static sfx_u8 _abort(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    if (sigfox_ep_addon_rfp_command_ctx.opened == SIGFOX_FALSE) {
+        return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_STATE;
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_abort_test_mode();
+    return _REPLY_STATUS(status);
+#else
+    SIGFOX_EP_ADDON_RFP_API_abort_test_mode();
+    return SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+#endif
+}
+
+/*!******************************************************************
+ * \fn static void _execute(void)
+ * \brief Execute the received command and send its reply.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _execute(void) {
+    // Local variables.
+    sfx_u8 identifier = sigfox_ep_addon_rfp_command_ctx.header[0];
+    sfx_u8 reply[SIGFOX_EP_ADDON_RFP_COMMAND_REPLY_SIZE_MAX_BYTES];
+    sfx_u8 reply_size_bytes = 1;
+    sfx_u8 expected_size_bytes = 0;
+    // Check command length.
+    switch (identifier) {
+    case SIGFOX_EP_ADDON_RFP_COMMAND_OPEN:
+        expected_size_bytes = SIGFOX_EP_ADDON_RFP_COMMAND_OPEN_SIZE_BYTES;
+        break;
+    case SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE:
+        expected_size_bytes = SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE_SIZE_BYTES;
+        break;
+    default:
+        expected_size_bytes = 0;
+        break;
+    }
+    if (sigfox_ep_addon_rfp_command_ctx.header[1] != expected_size_bytes) {
+        reply[0] = SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_LENGTH;
+        goto end;
+    }
+    switch (identifier) {
+    case SIGFOX_EP_ADDON_RFP_COMMAND_OPEN:
+        reply[0] = _open();
+        break;
+    case SIGFOX_EP_ADDON_RFP_COMMAND_CLOSE:
+        reply[0] = _close();
+        break;
+    case SIGFOX_EP_ADDON_RFP_COMMAND_TEST_MODE:
+        reply[0] = _test_mode();
+        break;
+    case SIGFOX_EP_ADDON_RFP_COMMAND_ABORT:
+        reply[0] = _abort();
+        break;
+    case SIGFOX_EP_ADDON_RFP_COMMAND_GET_PROGRESS:
+        reply[0] = SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+        if (sigfox_ep_addon_rfp_command_ctx.opened == SIGFOX_FALSE) {
+            reply[1] = SIGFOX_EP_ADDON_RFP_COMMAND_STATE_CLOSE;
+        }
+        else {
+            reply[1] = (sigfox_ep_addon_rfp_command_ctx.running == SIGFOX_TRUE) ? SIGFOX_EP_ADDON_RFP_COMMAND_STATE_RUNNING : SIGFOX_EP_ADDON_RFP_COMMAND_STATE_READY;
+        }
+        reply[2] = _get_progress();
+        reply_size_bytes = 3;
+        break;
+    case SIGFOX_EP_ADDON_RFP_COMMAND_GET_RESULT:
+        if ((sigfox_ep_addon_rfp_command_ctx.test_mode_started == SIGFOX_FALSE) || (sigfox_ep_addon_rfp_command_ctx.running == SIGFOX_TRUE)) {
+            reply[0] = SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_STATE;
+            break;
+        }
+        reply[0] = SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_SUCCESS;
+        reply[1] = sigfox_ep_addon_rfp_command_ctx.test_mode_reference;
+        reply[2] = _get_progress();
+        reply_size_bytes = 3;
+        break;
+    default:
+        reply[0] = SIGFOX_EP_ADDON_RFP_COMMAND_STATUS_ERROR_COMMAND;
+        break;
+    }
+end:
+    _send((sfx_u8) (identifier | SIGFOX_EP_ADDON_RFP_COMMAND_REPLY), reply, reply_size_bytes);
+}
+
+/*!******************************************************************
+ * \fn static void _parse(sfx_u8 data)
+ * \brief Add a received byte to the current command frame.
+ * \param[in]   data: Received byte.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _parse(sfx_u8 data) {
+    // Local variables.
+    sfx_u16 value_idx = 0;
+    if (sigfox_ep_addon_rfp_command_ctx.frame_idx < SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES) {
+        sigfox_ep_addon_rfp_command_ctx.header[sigfox_ep_addon_rfp_command_ctx.frame_idx] = data;
+    }
+    else {
+        // Bytes beyond the longest command are only counted to keep the framing.
+        value_idx = (sfx_u16) (sigfox_ep_addon_rfp_command_ctx.frame_idx - SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES);
+        if (value_idx < SIGFOX_EP_ADDON_RFP_COMMAND_VALUE_SIZE_MAX_BYTES) {
+            sigfox_ep_addon_rfp_command_ctx.value[value_idx] = data;
+        }
+    }
+    sigfox_ep_addon_rfp_command_ctx.frame_idx++;
+    if ((sigfox_ep_addon_rfp_command_ctx.frame_idx >= SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES) &&
+        (sigfox_ep_addon_rfp_command_ctx.frame_idx == (SIGFOX_EP_ADDON_RFP_COMMAND_HEADER_SIZE_BYTES + sigfox_ep_addon_rfp_command_ctx.header[1]))) {
+        sigfox_ep_addon_rfp_command_ctx.frame_idx = 0;
+        _execute();
+    }
+}
+
+/*** SIGFOX EP ADDON RFP COMMAND functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_init(const SIGFOX_EP_ADDON_RFP_COMMAND_config_t *config)
+ * \brief Initialize the command front-end. The addon is opened later by the open command.
+ * \param[in]   config: Pointer to the front-end configuration, which must remain valid while the front-end is used.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_init(const SIGFOX_EP_ADDON_RFP_COMMAND_config_t *config) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if ((config == SIGFOX_NULL) || (config->rc_table == SIGFOX_NULL) || (config->addon_config == SIGFOX_NULL) || (config->test_mode == SIGFOX_NULL) || (config->process_cb == SIGFOX_NULL) || (config->reply == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if (sigfox_ep_addon_rfp_command_ctx.opened == SIGFOX_TRUE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+    }
+    sigfox_ep_addon_rfp_command_ctx.config = config;
+    sigfox_ep_addon_rfp_command_ctx.rx_write_idx = 0;
+    sigfox_ep_addon_rfp_command_ctx.rx_read_idx = 0;
+    sigfox_ep_addon_rfp_command_ctx.rx_overflow = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_command_ctx.process_pending = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_command_ctx.frame_idx = 0;
+    sigfox_ep_addon_rfp_command_ctx.running = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_command_ctx.test_mode_started = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_command_ctx.test_mode_cplt = SIGFOX_FALSE;
+errors:
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_COMMAND_receive(sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Give the bytes received on the transport to the front-end. Can be called from the reception IRQ: the bytes are only buffered and the process callback is called.
+ * \param[in]   data: Received bytes.
+ * \param[in]   data_size_bytes: Number of received bytes.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_COMMAND_receive(sfx_u8 *data, sfx_u8 data_size_bytes) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    sfx_u8 next_write_idx = 0;
+    if ((sigfox_ep_addon_rfp_command_ctx.config == SIGFOX_NULL) || (data == SIGFOX_NULL)) {
+        return;
+    }
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        next_write_idx = (sfx_u8) ((sigfox_ep_addon_rfp_command_ctx.rx_write_idx + 1) % SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES);
+        if (next_write_idx == sigfox_ep_addon_rfp_command_ctx.rx_read_idx) {
+            sigfox_ep_addon_rfp_command_ctx.rx_overflow = SIGFOX_TRUE;
+            break;
+        }
+        sigfox_ep_addon_rfp_command_ctx.rx_buffer[sigfox_ep_addon_rfp_command_ctx.rx_write_idx] = data[idx];
+        sigfox_ep_addon_rfp_command_ctx.rx_write_idx = next_write_idx;
+    }
+    _notify_process();
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_process(void)
+ * \brief Process function of the front-end, to call when the process callback is triggered instead of the addon process function.
+ * \brief The addon events are handled first, then the received commands are executed and the replies are sent. No call blocks until a test mode is completed.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Status of the addon process function.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_COMMAND_process(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    sfx_u8 event[SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_TEST_MODE_CPLT_SIZE_BYTES];
+    sfx_u8 data = 0;
+    if (sigfox_ep_addon_rfp_command_ctx.config == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+    }
+    // Events raised from now on trigger the process callback again.
+    sigfox_ep_addon_rfp_command_ctx.process_pending = SIGFOX_FALSE;
+    // Addon events first, so that the test mode keeps its timing whatever the command traffic.
+    if ((sigfox_ep_addon_rfp_command_ctx.opened == SIGFOX_TRUE) && (SIGFOX_EP_ADDON_RFP_API_is_process_pending() == SIGFOX_TRUE)) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = SIGFOX_EP_ADDON_RFP_API_process();
+#else
+        SIGFOX_EP_ADDON_RFP_API_process();
+#endif
+    }
+    // Drop the partial command when bytes have been lost.
+    if (sigfox_ep_addon_rfp_command_ctx.rx_overflow == SIGFOX_TRUE) {
+        sigfox_ep_addon_rfp_command_ctx.rx_read_idx = sigfox_ep_addon_rfp_command_ctx.rx_write_idx;
+        sigfox_ep_addon_rfp_command_ctx.rx_overflow = SIGFOX_FALSE;
+        sigfox_ep_addon_rfp_command_ctx.frame_idx = 0;
+        _send(SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_RX_OVERFLOW, SIGFOX_NULL, SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_RX_OVERFLOW_SIZE_BYTES);
+    }
+    // Execute the received commands.
+    while (sigfox_ep_addon_rfp_command_ctx.rx_read_idx != sigfox_ep_addon_rfp_command_ctx.rx_write_idx) {
+        data = sigfox_ep_addon_rfp_command_ctx.rx_buffer[sigfox_ep_addon_rfp_command_ctx.rx_read_idx];
+        sigfox_ep_addon_rfp_command_ctx.rx_read_idx = (sfx_u8) ((sigfox_ep_addon_rfp_command_ctx.rx_read_idx + 1) % SIGFOX_EP_ADDON_RFP_COMMAND_RX_BUFFER_SIZE_BYTES);
+        _parse(data);
+    }
+    // Notify the end of the test mode.
+    if (sigfox_ep_addon_rfp_command_ctx.test_mode_cplt == SIGFOX_TRUE) {
+        sigfox_ep_addon_rfp_command_ctx.test_mode_cplt = SIGFOX_FALSE;
+        event[0] = sigfox_ep_addon_rfp_command_ctx.test_mode_reference;
+        event[1] = _get_progress();
+        _send(SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_TEST_MODE_CPLT, event, SIGFOX_EP_ADDON_RFP_COMMAND_EVENT_TEST_MODE_CPLT_SIZE_BYTES);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+#endif
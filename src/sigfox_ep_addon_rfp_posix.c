@@ -0,0 +1,334 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_posix.c
+ * \brief   Sigfox addon RF & Protocol POSIX port
+ * \details This file runs the asynchronous addon in a dedicated worker thread on POSIX hosts.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "sigfox_ep_addon_rfp_posix.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_error.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_POSIX)
+
+#include <pthread.h>
+
+/*** SIGFOX EP ADDON RFP POSIX local structures ***/
+
+typedef struct {
+    pthread_t worker;
+    pthread_once_t api_mutex_once;
+    pthread_mutex_t api_mutex;
+    pthread_mutex_t critical_mutex;
+    pthread_mutex_t event_mutex;
+    pthread_cond_t event_cond;
+    sfx_bool event;
+    sfx_bool stop;
+    sfx_bool opened;
+    SIGFOX_EP_ADDON_RFP_POSIX_post_cb_t post_cb;
+    SIGFOX_EP_ADDON_RFP_API_test_mode_cplt_cb_t test_mode_cplt_cb;
+} SIGFOX_EP_ADDON_RFP_POSIX_context_t;
+
+/*** SIGFOX EP ADDON RFP POSIX local global variables ***/
+
+static SIGFOX_EP_ADDON_RFP_POSIX_context_t sigfox_ep_addon_rfp_posix_ctx = {
+    .api_mutex_once = PTHREAD_ONCE_INIT,
+    .critical_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .event_mutex = PTHREAD_MUTEX_INITIALIZER,
+    .event_cond = PTHREAD_COND_INITIALIZER,
+    .event = SIGFOX_FALSE,
+    .stop = SIGFOX_FALSE,
+    .opened = SIGFOX_FALSE,
+    .post_cb = SIGFOX_NULL,
+    .test_mode_cplt_cb = SIGFOX_NULL,
+};
+
+/*** SIGFOX EP ADDON RFP POSIX local functions ***/
+
+/*!******************************************************************
+ * \fn static void _api_mutex_init(void)
+ * \brief Initialize the recursive API lock.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _api_mutex_init(void) {
+    // Local variables.
+    pthread_mutexattr_t mutex_attr;
+    // The API lock is recursive so that callbacks executed in the worker thread can call the addon.
+    pthread_mutexattr_init(&mutex_attr);
+    pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&sigfox_ep_addon_rfp_posix_ctx.api_mutex, &mutex_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+}
+
+/*!******************************************************************
+ * \fn static void _process_cb(void)
+ * \brief Addon process callback, which wakes up the worker thread.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _process_cb(void) {
+    // Wake-up the worker thread.
+    pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.event_mutex);
+    sigfox_ep_addon_rfp_posix_ctx.event = SIGFOX_TRUE;
+    pthread_cond_signal(&sigfox_ep_addon_rfp_posix_ctx.event_cond);
+    pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.event_mutex);
+}
+
+/*!******************************************************************
+ * \fn static void _test_mode_cplt_cb(void)
+ * \brief Test mode completion callback, forwarded to the application through the post callback if any.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _test_mode_cplt_cb(void) {
+    if (sigfox_ep_addon_rfp_posix_ctx.test_mode_cplt_cb == SIGFOX_NULL) {
+        return;
+    }
+    // Execute user callback in the thread chosen by the application.
+    if (sigfox_ep_addon_rfp_posix_ctx.post_cb != SIGFOX_NULL) {
+        sigfox_ep_addon_rfp_posix_ctx.post_cb(sigfox_ep_addon_rfp_posix_ctx.test_mode_cplt_cb);
+    }
+    else {
+        sigfox_ep_addon_rfp_posix_ctx.test_mode_cplt_cb();
+    }
+}
+
+/*!******************************************************************
+ * \fn static void *_worker(void *arg)
+ * \brief Worker thread, which calls the addon process function on each event.
+ * \param[in]   arg: Unused.
+ * \param[out]  none
+ * \retval      SIGFOX_NULL.
+ *******************************************************************/
+static void *_worker(void *arg) {
+    // Local variables.
+    sfx_bool stop = SIGFOX_FALSE;
+    (void) arg;
+    while (stop == SIGFOX_FALSE) {
+        // Sleep until an event is raised by the addon.
+        pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.event_mutex);
+        while ((sigfox_ep_addon_rfp_posix_ctx.event == SIGFOX_FALSE) && (sigfox_ep_addon_rfp_posix_ctx.stop == SIGFOX_FALSE)) {
+            pthread_cond_wait(&sigfox_ep_addon_rfp_posix_ctx.event_cond, &sigfox_ep_addon_rfp_posix_ctx.event_mutex);
+        }
+        sigfox_ep_addon_rfp_posix_ctx.event = SIGFOX_FALSE;
+        stop = sigfox_ep_addon_rfp_posix_ctx.stop;
+        pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.event_mutex);
+        if (stop == SIGFOX_FALSE) {
+            pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+            SIGFOX_EP_ADDON_RFP_API_process();
+            pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+        }
+    }
+    return SIGFOX_NULL;
+}
+
+/*** SIGFOX EP ADDON RFP POSIX functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_open(SIGFOX_EP_ADDON_RFP_POSIX_config_t *config)
+ * \brief Open the RFP addon and start the worker thread. The process callback of the addon configuration is replaced by the worker thread wake-up.
+ * \param[in]   config: Pointer to the port configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_open(SIGFOX_EP_ADDON_RFP_POSIX_config_t *config) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_RFP_API_config_t addon_config;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if ((config == SIGFOX_NULL) || (config->addon_config == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if (sigfox_ep_addon_rfp_posix_ctx.opened == SIGFOX_TRUE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+    }
+    pthread_once(&sigfox_ep_addon_rfp_posix_ctx.api_mutex_once, &_api_mutex_init);
+    sigfox_ep_addon_rfp_posix_ctx.post_cb = config->post_cb;
+    sigfox_ep_addon_rfp_posix_ctx.event = SIGFOX_FALSE;
+    sigfox_ep_addon_rfp_posix_ctx.stop = SIGFOX_FALSE;
+    // Open addon with the worker thread wake-up as process callback.
+    addon_config = *(config->addon_config);
+    addon_config.process_cb = &_process_cb;
+    pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_open(&addon_config);
+#else
+    SIGFOX_EP_ADDON_RFP_API_open(&addon_config);
+#endif
+    pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+#endif
+    // Start worker thread.
+    if (pthread_create(&sigfox_ep_addon_rfp_posix_ctx.worker, SIGFOX_NULL, &_worker, SIGFOX_NULL) != 0) {
+        SIGFOX_EP_ADDON_RFP_API_close();
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_POSIX);
+    }
+    sigfox_ep_addon_rfp_posix_ctx.opened = SIGFOX_TRUE;
+errors:
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_close(void)
+ * \brief Stop the worker thread and close the RFP addon.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_close(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    if (sigfox_ep_addon_rfp_posix_ctx.opened == SIGFOX_FALSE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+    }
+    // Stop worker thread.
+    pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.event_mutex);
+    sigfox_ep_addon_rfp_posix_ctx.stop = SIGFOX_TRUE;
+    pthread_cond_signal(&sigfox_ep_addon_rfp_posix_ctx.event_cond);
+    pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.event_mutex);
+    pthread_join(sigfox_ep_addon_rfp_posix_ctx.worker, SIGFOX_NULL);
+    sigfox_ep_addon_rfp_posix_ctx.opened = SIGFOX_FALSE;
+    // Close addon.
+    pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_close();
+#else
+    SIGFOX_EP_ADDON_RFP_API_close();
+#endif
+    pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+errors:
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode)
+ * \brief Start a test mode from any thread. The completion callback is executed through the post callback of the port configuration.
+ * \param[in]   test_mode: Pointer to the test_mode data.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_POSIX_test_mode(SIGFOX_EP_ADDON_RFP_API_test_mode_t *test_mode) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_RFP_API_test_mode_t local_test_mode;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (test_mode == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if (sigfox_ep_addon_rfp_posix_ctx.opened == SIGFOX_FALSE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+    }
+    // Route the completion callback through the post callback.
+    local_test_mode = *test_mode;
+    local_test_mode.test_mode_cplt_cb = &_test_mode_cplt_cb;
+    pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+    // The completion is executed by the worker thread once the lock is released.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_RFP_API_test_mode(&local_test_mode);
+    // Keep the callback of a test mode already running when the request is rejected.
+    if (status == SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+        sigfox_ep_addon_rfp_posix_ctx.test_mode_cplt_cb = test_mode->test_mode_cplt_cb;
+    }
+#else
+    SIGFOX_EP_ADDON_RFP_API_test_mode(&local_test_mode);
+    sigfox_ep_addon_rfp_posix_ctx.test_mode_cplt_cb = test_mode->test_mode_cplt_cb;
+#endif
+    pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+errors:
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_lock(void)
+ * \brief Take the addon lock. Must surround any other addon API call made outside of the worker thread.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_lock(void) {
+    pthread_once(&sigfox_ep_addon_rfp_posix_ctx.api_mutex_once, &_api_mutex_init);
+    pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_unlock(void)
+ * \brief Release the addon lock.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_unlock(void) {
+    pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.api_mutex);
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_enter_critical(void)
+ * \brief Protect the addon event flags against concurrent updates (used by the addon itself).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_enter_critical(void) {
+    pthread_mutex_lock(&sigfox_ep_addon_rfp_posix_ctx.critical_mutex);
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_POSIX_exit_critical(void)
+ * \brief Release the addon event flags protection (used by the addon itself).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_POSIX_exit_critical(void) {
+    pthread_mutex_unlock(&sigfox_ep_addon_rfp_posix_ctx.critical_mutex);
+}
+
+#endif
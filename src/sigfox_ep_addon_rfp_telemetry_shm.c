@@ -0,0 +1,289 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_rfp_telemetry_shm.c
+ * \brief   Sigfox addon RF & Protocol telemetry segment writer
+ * \details This file publishes the progress status and the result stream records of the addon in a POSIX shared
+ *          memory segment (format described in sigfox_ep_addon_rfp_telemetry.h).
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L // shm_open and ftruncate with a strict C standard.
+#endif
+
+#include "sigfox_ep_addon_rfp_telemetry_shm.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_error.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "sigfox_ep_addon_rfp_stream.h"
+#include "sigfox_ep_addon_rfp_telemetry.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_TELEMETRY)
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*** SIGFOX EP ADDON RFP TELEMETRY local macros ***/
+
+#define SIGFOX_EP_ADDON_RFP_TELEMETRY_NAME_SIZE_MAX_BYTES   256
+
+/*** SIGFOX EP ADDON RFP TELEMETRY local structures ***/
+
+typedef struct {
+    sfx_bool opened;
+    int fd;
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header;
+    sfx_u8 *ring;
+    sfx_u32 ring_size_bytes;
+    sfx_u32 segment_size_bytes;
+    SIGFOX_EP_ADDON_RFP_API_stream_write_cb_t stream_write;
+    sfx_char name[SIGFOX_EP_ADDON_RFP_TELEMETRY_NAME_SIZE_MAX_BYTES];
+} SIGFOX_EP_ADDON_RFP_TELEMETRY_context_t;
+
+/*** SIGFOX EP ADDON RFP TELEMETRY local global variables ***/
+
+static SIGFOX_EP_ADDON_RFP_TELEMETRY_context_t sigfox_ep_addon_rfp_telemetry_ctx = {
+    .opened = SIGFOX_FALSE,
+    .fd = -1,
+    .header = SIGFOX_NULL,
+    .ring = SIGFOX_NULL,
+    .ring_size_bytes = 0,
+    .segment_size_bytes = 0,
+    .stream_write = SIGFOX_NULL,
+    .name = { 0 },
+};
+
+/*** SIGFOX EP ADDON RFP TELEMETRY local functions ***/
+
+/*!******************************************************************
+ * \fn static void _begin_update(void)
+ * \brief Start an update of the shared memory (odd sequence).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _begin_update(void) {
+    // Odd sequence: the readers retry until the update is done.
+    __atomic_store_n(&sigfox_ep_addon_rfp_telemetry_ctx.header->sequence, sigfox_ep_addon_rfp_telemetry_ctx.header->sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+/*!******************************************************************
+ * \fn static void _end_update(void)
+ * \brief End an update of the shared memory (even sequence).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _end_update(void) {
+    __atomic_store_n(&sigfox_ep_addon_rfp_telemetry_ctx.header->sequence, sigfox_ep_addon_rfp_telemetry_ctx.header->sequence + 1, __ATOMIC_RELEASE);
+}
+
+/*!******************************************************************
+ * \fn static void _write_ring(sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Write a record to the ring of the shared memory.
+ * \param[in]   data: Record bytes.
+ * \param[in]   data_size_bytes: Record size.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _write_ring(sfx_u8 *data, sfx_u8 data_size_bytes) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header = sigfox_ep_addon_rfp_telemetry_ctx.header;
+    sfx_u32 position = (sfx_u32) (header->write_offset % sigfox_ep_addon_rfp_telemetry_ctx.ring_size_bytes);
+    sfx_u32 first_size_bytes = sigfox_ep_addon_rfp_telemetry_ctx.ring_size_bytes - position;
+    // Publish the new write offset before overwriting the oldest bytes of the ring.
+    __atomic_store_n(&(header->write_offset), header->write_offset + data_size_bytes, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    if (first_size_bytes > data_size_bytes) {
+        first_size_bytes = data_size_bytes;
+    }
+    memcpy(&(sigfox_ep_addon_rfp_telemetry_ctx.ring[position]), data, first_size_bytes);
+    memcpy(sigfox_ep_addon_rfp_telemetry_ctx.ring, &(data[first_size_bytes]), data_size_bytes - first_size_bytes);
+}
+
+/*** SIGFOX EP ADDON RFP TELEMETRY functions ***/
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_config_t *config)
+ * \brief Create and map the telemetry segment. A segment left with the same name by a previous station is replaced,
+ * \brief the aggregators which still map it see it as closed.
+ * \param[in]   config: Pointer to the telemetry configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_open(SIGFOX_EP_ADDON_RFP_TELEMETRY_config_t *config) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header = SIGFOX_NULL;
+    sfx_u32 ring_size_bytes = SIGFOX_EP_ADDON_RFP_TELEMETRY_RING_SIZE_DEFAULT_BYTES;
+    void *segment = MAP_FAILED;
+    int fd = -1;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if ((config == SIGFOX_NULL) || (config->name == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // The ring must hold several records so that a record is never wrapped more than once.
+    if (((config->ring_size_bytes != 0) && (config->ring_size_bytes < SIGFOX_EP_ADDON_RFP_TELEMETRY_RING_SIZE_MIN_BYTES)) || (strlen(config->name) >= SIGFOX_EP_ADDON_RFP_TELEMETRY_NAME_SIZE_MAX_BYTES)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TELEMETRY);
+    }
+    if (sigfox_ep_addon_rfp_telemetry_ctx.opened == SIGFOX_TRUE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+    }
+    if (config->ring_size_bytes != 0) {
+        ring_size_bytes = config->ring_size_bytes;
+    }
+    // Always create a new object so that the aggregators still mapping a previous segment never see it shrink.
+    shm_unlink(config->name);
+    fd = shm_open(config->name, (O_CREAT | O_EXCL | O_RDWR), 0644);
+    if (fd < 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TELEMETRY);
+    }
+    if (ftruncate(fd, (off_t) (SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES + ring_size_bytes)) == 0) {
+        segment = mmap(SIGFOX_NULL, (size_t) (SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES + ring_size_bytes), (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+    }
+    if (segment == MAP_FAILED) {
+        close(fd);
+        shm_unlink(config->name);
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_TELEMETRY);
+    }
+    // Initialize header (the new object is zeroed), the magic number is written last.
+    header = (SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *) segment;
+    header->version = SIGFOX_EP_ADDON_RFP_TELEMETRY_VERSION;
+    header->header_size_bytes = SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES;
+    header->ring_size_bytes = ring_size_bytes;
+    header->writer_pid = (uint32_t) getpid();
+    __atomic_store_n(&(header->magic), SIGFOX_EP_ADDON_RFP_TELEMETRY_MAGIC, __ATOMIC_RELEASE);
+    // Update context.
+    sigfox_ep_addon_rfp_telemetry_ctx.fd = fd;
+    sigfox_ep_addon_rfp_telemetry_ctx.header = header;
+    sigfox_ep_addon_rfp_telemetry_ctx.ring = ((sfx_u8 *) segment) + SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES;
+    sigfox_ep_addon_rfp_telemetry_ctx.ring_size_bytes = ring_size_bytes;
+    sigfox_ep_addon_rfp_telemetry_ctx.segment_size_bytes = SIGFOX_EP_ADDON_RFP_TELEMETRY_HEADER_SIZE_BYTES + ring_size_bytes;
+    sigfox_ep_addon_rfp_telemetry_ctx.stream_write = config->stream_write;
+    strcpy(sigfox_ep_addon_rfp_telemetry_ctx.name, config->name);
+    sigfox_ep_addon_rfp_telemetry_ctx.opened = SIGFOX_TRUE;
+errors:
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_close(void)
+ * \brief Mark the telemetry segment as closed, unmap and remove it. The aggregators keep their mapping until they close it.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_EP_ADDON_RFP_TELEMETRY_close(void) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+#endif
+    if (sigfox_ep_addon_rfp_telemetry_ctx.opened == SIGFOX_FALSE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_RFP_API_ERROR_STATE);
+    }
+    _begin_update();
+    sigfox_ep_addon_rfp_telemetry_ctx.header->state = (sfx_u8) ((sigfox_ep_addon_rfp_telemetry_ctx.header->state & (~SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_RUNNING)) | SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_CLOSED);
+    _end_update();
+    sigfox_ep_addon_rfp_telemetry_ctx.opened = SIGFOX_FALSE;
+    munmap(sigfox_ep_addon_rfp_telemetry_ctx.header, (size_t) sigfox_ep_addon_rfp_telemetry_ctx.segment_size_bytes);
+    close(sigfox_ep_addon_rfp_telemetry_ctx.fd);
+    shm_unlink(sigfox_ep_addon_rfp_telemetry_ctx.name);
+    sigfox_ep_addon_rfp_telemetry_ctx.fd = -1;
+    sigfox_ep_addon_rfp_telemetry_ctx.header = SIGFOX_NULL;
+    sigfox_ep_addon_rfp_telemetry_ctx.ring = SIGFOX_NULL;
+errors:
+    SIGFOX_RETURN();
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_RFP_TELEMETRY_stream_write(sfx_u8 *data, sfx_u8 data_size_bytes)
+ * \brief Result stream hook to be given as stream_write of the addon configuration. Each record is copied in the ring
+ * \brief and the progress status of the header is updated, without any system call.
+ * \param[in]   data: Record bytes.
+ * \param[in]   data_size_bytes: Record size.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_RFP_TELEMETRY_stream_write(sfx_u8 *data, sfx_u8 data_size_bytes) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_TELEMETRY_header_t *header = sigfox_ep_addon_rfp_telemetry_ctx.header;
+    SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
+    // Forward record to the test station link.
+    if (sigfox_ep_addon_rfp_telemetry_ctx.stream_write != SIGFOX_NULL) {
+        sigfox_ep_addon_rfp_telemetry_ctx.stream_write(data, data_size_bytes);
+    }
+    if ((sigfox_ep_addon_rfp_telemetry_ctx.opened == SIGFOX_FALSE) || (data_size_bytes < SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES)) {
+        return;
+    }
+    _begin_update();
+    _write_ring(data, data_size_bytes);
+    header->number_of_records++;
+    switch (data[0]) {
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_START:
+        if (data_size_bytes < (SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES + SIGFOX_EP_ADDON_RFP_STREAM_START_SIZE_BYTES)) {
+            break;
+        }
+        header->state |= SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_RUNNING;
+        header->test_mode_reference = data[SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES + 1];
+        header->progress = 0;
+        header->number_of_test_modes++;
+        break;
+    case SIGFOX_EP_ADDON_RFP_STREAM_TAG_END:
+        if (data_size_bytes < (SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES + SIGFOX_EP_ADDON_RFP_STREAM_END_SIZE_BYTES)) {
+            break;
+        }
+        header->state &= (sfx_u8) (~SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_RUNNING);
+        header->progress = data[SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES];
+        header->status = data[SIGFOX_EP_ADDON_RFP_STREAM_HEADER_SIZE_BYTES + 1];
+        break;
+    default:
+        if ((header->state & SIGFOX_EP_ADDON_RFP_TELEMETRY_STATE_RUNNING) == 0) {
+            break;
+        }
+        progress_status = SIGFOX_EP_ADDON_RFP_API_get_test_mode_progress_status();
+        header->progress = (sfx_u8) ((progress_status.status.error != 0) ? SIGFOX_EP_ADDON_RFP_STREAM_END_ERROR : 0) | (sfx_u8) (progress_status.progress & SIGFOX_EP_ADDON_RFP_STREAM_END_PROGRESS_MASK);
+        break;
+    }
+    _end_update();
+}
+
+#endif
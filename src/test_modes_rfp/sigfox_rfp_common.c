@@ -0,0 +1,775 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_common.c
+ * \brief   Sigfox addon RF & Protocol common helpers
+ * \details This file provides the helpers shared by the RF & Protocol test modes.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "test_modes_rfp/sigfox_rfp_common.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "manuf/mcu_api.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+#include "test_modes_rfp/sigfox_rfp_energy.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+#include "test_modes_rfp/sigfox_rfp_timer.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+#include "test_modes_rfp/sigfox_rfp_throughput.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+#include "test_modes_rfp/sigfox_rfp_uplink_timing.h"
+#endif
+#ifdef SIGFOX_EP_CERTIFICATION
+
+/*** SIGFOX RFP COMMON local macros ***/
+
+// Preamble (19 bits) and frame type (13 bits).
+#define SIGFOX_RFP_COMMON_UL_SYNC_SIZE_BYTES        4
+// Header, device ID, authentication and CRC of an empty frame.
+#define SIGFOX_RFP_COMMON_UL_EMPTY_FRAME_SIZE_BYTES 10
+#define SIGFOX_RFP_COMMON_DEFAULT_T_IFU_MS          500
+
+// The test mode timer is a logical timer of the wheel when enabled.
+#ifdef SIGFOX_EP_ADDON_RFP_TIMER_WHEEL
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+#define _TIMER_START(timer)     SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_ID_TEST_MODE, (timer)->duration_ms, (timer)->cplt_cb)
+#else
+#define _TIMER_START(timer)     SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_ID_TEST_MODE, (timer)->duration_ms, SIGFOX_NULL)
+#endif
+#define _TIMER_STOP()           SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_ID_TEST_MODE)
+#define _TIMER_WAIT_CPLT()      SIGFOX_RFP_TIMER_wait_cplt(SIGFOX_RFP_TIMER_ID_TEST_MODE)
+#else
+#define _TIMER_START(timer)     MCU_API_timer_start(timer)
+#define _TIMER_STOP()           MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP)
+#define _TIMER_WAIT_CPLT()      MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP)
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+/*** SIGFOX RFP COMMON local structures ***/
+
+typedef struct {
+    sfx_u32 margin_ms;
+    SIGFOX_RFP_COMMON_deadline_cb_t deadline_cb;
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb;
+} SIGFOX_RFP_COMMON_deadline_context_t;
+
+/*** SIGFOX RFP COMMON local global variables ***/
+
+static SIGFOX_RFP_COMMON_deadline_context_t sigfox_rfp_common_deadline_ctx = {
+    .margin_ms = 0,
+    .deadline_cb = SIGFOX_NULL,
+    .message_cplt_cb = SIGFOX_NULL,
+};
+#endif
+
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+/*** SIGFOX RFP COMMON local structures ***/
+
+typedef struct {
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb;
+    SIGFOX_RFP_COMMON_message_dropped_cb_t message_dropped_cb;
+    sfx_bool message_pending;
+} SIGFOX_RFP_COMMON_message_context_t;
+
+/*** SIGFOX RFP COMMON local global variables ***/
+
+static SIGFOX_RFP_COMMON_message_context_t sigfox_rfp_common_message_ctx = {
+    .message_cplt_cb = SIGFOX_NULL,
+    .message_dropped_cb = SIGFOX_NULL,
+    .message_pending = SIGFOX_FALSE,
+};
+#endif
+
+/*** SIGFOX RFP COMMON local functions ***/
+
+/*!******************************************************************
+ * \fn static void _get_common_parameters_airtime(const SIGFOX_EP_API_common_t *common_parameters, sfx_u8 ul_payload_size_bytes, SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Compute the uplink durations of a message from its common parameters.
+ * \param[in]   common_parameters: Common parameters of the message.
+ * \param[in]   ul_payload_size_bytes: User payload size.
+ * \param[out]  airtime: Durations of the message radio activities.
+ * \retval      none
+ *******************************************************************/
+#ifdef SIGFOX_RFP_COMMON_PARAMETERS
+static void _get_common_parameters_airtime(const SIGFOX_EP_API_common_t *common_parameters, sfx_u8 ul_payload_size_bytes, SIGFOX_RFP_COMMON_airtime_t *airtime) {
+#else
+static void _get_common_parameters_airtime(sfx_u8 ul_payload_size_bytes, SIGFOX_RFP_COMMON_airtime_t *airtime) {
+#endif
+    // Local variables.
+    sfx_u16 ul_bit_rate_bps;
+    sfx_u8 number_of_frames = 1;
+#ifdef SIGFOX_EP_T_IFU_MS
+    sfx_u32 t_ifu_ms = SIGFOX_EP_T_IFU_MS;
+#else
+    sfx_u32 t_ifu_ms = SIGFOX_RFP_COMMON_DEFAULT_T_IFU_MS;
+#endif
+#if (defined SIGFOX_RFP_COMMON_PARAMETERS) && (defined SIGFOX_EP_SINGLE_FRAME) && (defined SIGFOX_EP_UL_BIT_RATE_BPS) && (defined SIGFOX_EP_TX_POWER_DBM_EIRP)
+    // Only the public key type is left in the common parameters.
+    (void) common_parameters;
+#endif
+#ifdef SIGFOX_EP_UL_BIT_RATE_BPS
+    ul_bit_rate_bps = SIGFOX_EP_UL_BIT_RATE_BPS;
+#else
+    ul_bit_rate_bps = (common_parameters->ul_bit_rate == SIGFOX_UL_BIT_RATE_600BPS) ? 600 : 100;
+#endif
+#ifdef SIGFOX_EP_TX_POWER_DBM_EIRP
+    airtime->tx_power_dbm_eirp = SIGFOX_EP_TX_POWER_DBM_EIRP;
+#else
+    airtime->tx_power_dbm_eirp = common_parameters->tx_power_dbm_eirp;
+#endif
+#ifndef SIGFOX_EP_SINGLE_FRAME
+    number_of_frames = common_parameters->number_of_frames;
+#ifndef SIGFOX_EP_T_IFU_MS
+    if (common_parameters->t_ifu_ms != 0) {
+        t_ifu_ms = common_parameters->t_ifu_ms;
+    }
+#endif
+#endif
+    if (number_of_frames == 0) {
+        number_of_frames = 1;
+    }
+    airtime->tx_ms = number_of_frames * SIGFOX_RFP_COMMON_get_ul_frame_duration_ms(ul_payload_size_bytes, ul_bit_rate_bps);
+    airtime->ifu_ms = (number_of_frames - 1) * t_ifu_ms;
+}
+
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+/*!******************************************************************
+ * \fn static void _get_downlink_airtime(const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Compute the downlink durations of a message from its test parameters.
+ * \param[in]   test_param: Test parameters of the message.
+ * \param[out]  airtime: Durations of the message radio activities.
+ * \retval      none
+ *******************************************************************/
+static void _get_downlink_airtime(const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime) {
+    if (test_param->flags.field.dl_enable == 0) {
+        return;
+    }
+    airtime->t_w_ms = (test_param->dl_t_w_ms != 0) ? test_param->dl_t_w_ms : SIGFOX_RFP_COMMON_DEFAULT_DL_T_W_MS;
+    airtime->rx_ms = (test_param->dl_t_rx_ms != 0) ? test_param->dl_t_rx_ms : SIGFOX_RFP_COMMON_DEFAULT_DL_T_RX_MS;
+    // Listening phase only: there is no uplink to wait for.
+    if (test_param->flags.field.ul_enable == 0) {
+        airtime->t_w_ms = 0;
+    }
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+/*!******************************************************************
+ * \fn static void _message_cplt_cb(void)
+ * \brief Supervised message completion callback, which stops the step deadline.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _message_cplt_cb(void) {
+    // Local variables.
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb = sigfox_rfp_common_deadline_ctx.message_cplt_cb;
+    // Completion received after the deadline is discarded.
+    if (message_cplt_cb == SIGFOX_NULL) {
+        return;
+    }
+    sigfox_rfp_common_deadline_ctx.message_cplt_cb = SIGFOX_NULL;
+    SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_ID_STEP_DEADLINE);
+    message_cplt_cb();
+}
+
+/*!******************************************************************
+ * \fn static void _deadline_cplt_cb(void)
+ * \brief Step deadline expiration callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _deadline_cplt_cb(void) {
+    sigfox_rfp_common_deadline_ctx.message_cplt_cb = SIGFOX_NULL;
+    if (sigfox_rfp_common_deadline_ctx.deadline_cb != SIGFOX_NULL) {
+        sigfox_rfp_common_deadline_ctx.deadline_cb();
+    }
+}
+
+/*!******************************************************************
+ * \fn static sfx_u32 _get_deadline_ms(const SIGFOX_EP_API_TEST_parameters_t *test_param, const SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Compute the step deadline of a message.
+ * \param[in]   test_param: Test parameters of the message.
+ * \param[in]   airtime: Durations of the message radio activities.
+ * \param[out]  none
+ * \retval      Deadline in ms, 0 if the message duration is not bounded.
+ *******************************************************************/
+static sfx_u32 _get_deadline_ms(const SIGFOX_EP_API_TEST_parameters_t *test_param, const SIGFOX_RFP_COMMON_airtime_t *airtime) {
+    // Local variables.
+    sfx_u32 deadline_ms = (airtime->tx_ms + airtime->ifu_ms + airtime->t_w_ms + airtime->rx_ms + sigfox_rfp_common_deadline_ctx.margin_ms);
+#if !((defined SIGFOX_EP_REGULATORY) && ((defined SIGFOX_EP_SPECTRUM_ACCESS_FH) || (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT) || (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)))
+    (void) test_param;
+#endif
+#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_FH)
+    // The frequency hopping control can defer the message for an unbounded time.
+    if (test_param->flags.field.tx_control_fh_enable != 0) {
+        return 0;
+    }
+#endif
+#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)
+    // The duty cycle control can defer the message for an unbounded time.
+    if (test_param->flags.field.tx_control_ldc_enable != 0) {
+        return 0;
+    }
+#endif
+#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
+    if (test_param->flags.field.tx_control_lbt_enable != 0) {
+        // The default carrier sense duration of the RC is not known by the addon.
+        if (test_param->lbt_cs_max_duration_first_frame_ms == 0) {
+            return 0;
+        }
+        // The first frame is sensed up to the configured duration, the next ones up to the inter-frame delay each.
+        deadline_ms += (test_param->lbt_cs_max_duration_first_frame_ms + airtime->ifu_ms);
+    }
+#endif
+    return deadline_ms;
+}
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_API_status_t _start_deadline(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb, sfx_u32 deadline_ms)
+ * \brief Start the supervision of a message.
+ * \param[in]   message_cplt_cb: Message completion callback.
+ * \param[in]   deadline_ms: Step deadline.
+ * \param[out]  message_cplt_cb: Supervised completion callback.
+ * \retval      Function execution status.
+ *******************************************************************/
+static SIGFOX_EP_API_status_t _start_deadline(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb, sfx_u32 deadline_ms) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+    // Route the message completion through the supervision.
+    sigfox_rfp_common_deadline_ctx.message_cplt_cb = (*message_cplt_cb);
+    (*message_cplt_cb) = &_message_cplt_cb;
+#ifdef SIGFOX_EP_ERROR_CODES
+    mcu_api_status = SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_ID_STEP_DEADLINE, deadline_ms, &_deadline_cplt_cb);
+    if (mcu_api_status != MCU_API_SUCCESS) {
+        return SIGFOX_EP_API_ERROR_MCU;
+    }
+    return SIGFOX_EP_API_SUCCESS;
+#else
+    SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_ID_STEP_DEADLINE, deadline_ms, &_deadline_cplt_cb);
+#endif
+}
+
+#ifdef SIGFOX_EP_ERROR_CODES
+/*!******************************************************************
+ * \fn static void _cancel_deadline(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb)
+ * \brief Cancel the supervision of a message which could not be sent.
+ * \param[in]   none
+ * \param[out]  message_cplt_cb: Original message completion callback.
+ * \retval      none
+ *******************************************************************/
+static void _cancel_deadline(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb) {
+    (*message_cplt_cb) = sigfox_rfp_common_deadline_ctx.message_cplt_cb;
+    sigfox_rfp_common_deadline_ctx.message_cplt_cb = SIGFOX_NULL;
+    SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_ID_STEP_DEADLINE);
+}
+#endif
+#endif
+
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+/*!******************************************************************
+ * \fn static void _tracked_message_cplt_cb(void)
+ * \brief Tracked message completion callback, forwarded to the test mode unless the message was dropped.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _tracked_message_cplt_cb(void) {
+    // Local variables.
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb = sigfox_rfp_common_message_ctx.message_cplt_cb;
+    SIGFOX_RFP_COMMON_message_dropped_cb_t message_dropped_cb = sigfox_rfp_common_message_ctx.message_dropped_cb;
+    sigfox_rfp_common_message_ctx.message_cplt_cb = SIGFOX_NULL;
+    sigfox_rfp_common_message_ctx.message_dropped_cb = SIGFOX_NULL;
+    sigfox_rfp_common_message_ctx.message_pending = SIGFOX_FALSE;
+    // Completion of a message sent by an aborted test mode does not reach the test mode.
+    if (message_dropped_cb != SIGFOX_NULL) {
+        message_dropped_cb();
+    }
+    else if (message_cplt_cb != SIGFOX_NULL) {
+        message_cplt_cb();
+    }
+}
+
+/*!******************************************************************
+ * \fn static void _start_message(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb)
+ * \brief Start the tracking of a message.
+ * \param[in]   message_cplt_cb: Message completion callback.
+ * \param[out]  message_cplt_cb: Tracked completion callback.
+ * \retval      none
+ *******************************************************************/
+static void _start_message(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb) {
+    // Route the message completion through the tracking, after all the other hooks.
+    sigfox_rfp_common_message_ctx.message_cplt_cb = (*message_cplt_cb);
+    sigfox_rfp_common_message_ctx.message_dropped_cb = SIGFOX_NULL;
+    sigfox_rfp_common_message_ctx.message_pending = SIGFOX_TRUE;
+    (*message_cplt_cb) = &_tracked_message_cplt_cb;
+}
+
+#ifdef SIGFOX_EP_ERROR_CODES
+/*!******************************************************************
+ * \fn static void _cancel_message(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb)
+ * \brief Cancel the tracking of a message which could not be sent.
+ * \param[in]   none
+ * \param[out]  message_cplt_cb: Original message completion callback.
+ * \retval      none
+ *******************************************************************/
+static void _cancel_message(SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb) {
+    (*message_cplt_cb) = sigfox_rfp_common_message_ctx.message_cplt_cb;
+    sigfox_rfp_common_message_ctx.message_cplt_cb = SIGFOX_NULL;
+    sigfox_rfp_common_message_ctx.message_pending = SIGFOX_FALSE;
+}
+#endif
+#endif
+
+/*** SIGFOX RFP COMMON functions ***/
+
+/*!******************************************************************
+ * \fn sfx_u32 SIGFOX_RFP_COMMON_get_ul_frame_duration_ms(sfx_u8 ul_payload_size_bytes, sfx_u16 ul_bit_rate_bps)
+ * \brief Compute the on-air duration of a single uplink frame.
+ * \param[in]   ul_payload_size_bytes: User payload size (0 for bit and empty frames).
+ * \param[in]   ul_bit_rate_bps: Uplink bit rate in bps.
+ * \param[out]  none
+ * \retval      Frame duration in ms.
+ *******************************************************************/
+sfx_u32 SIGFOX_RFP_COMMON_get_ul_frame_duration_ms(sfx_u8 ul_payload_size_bytes, sfx_u16 ul_bit_rate_bps) {
+    // Local variables.
+    sfx_u32 frame_size_bytes = SIGFOX_RFP_COMMON_UL_SYNC_SIZE_BYTES + SIGFOX_RFP_COMMON_UL_EMPTY_FRAME_SIZE_BYTES;
+    // Payload is padded to 1, 4, 8 or 12 bytes.
+    if (ul_payload_size_bytes == 1) {
+        frame_size_bytes += 1;
+    }
+    else if (ul_payload_size_bytes > 1) {
+        frame_size_bytes += ((ul_payload_size_bytes + 3) & 0xFC);
+    }
+    if (ul_bit_rate_bps == 0) {
+        return 0;
+    }
+    return ((frame_size_bytes * 8 * 1000) / ul_bit_rate_bps);
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn sfx_u32 SIGFOX_RFP_COMMON_get_ul_message_duration_ms(const SIGFOX_RFP_test_mode_t *rfp_test_mode, sfx_u8 ul_payload_size_bytes, sfx_u8 number_of_frames, sfx_u32 t_ifu_ms)
+ * \brief Compute the uplink duration of a message sent by a test mode, including the inter-frame delays.
+ * \param[in]   rfp_test_mode: Test mode parameters.
+ * \param[in]   ul_payload_size_bytes: User payload size (0 for bit and empty frames).
+ * \param[in]   number_of_frames: Number of frames requested by the test mode (ignored in single frame mode).
+ * \param[in]   t_ifu_ms: Inter-frame delay requested by the test mode (ignored if fixed by the flags).
+ * \param[out]  none
+ * \retval      Message uplink duration in ms.
+ *******************************************************************/
+sfx_u32 SIGFOX_RFP_COMMON_get_ul_message_duration_ms(const SIGFOX_RFP_test_mode_t *rfp_test_mode, sfx_u8 ul_payload_size_bytes, sfx_u8 number_of_frames, sfx_u32 t_ifu_ms) {
+    // Local variables.
+    sfx_u16 ul_bit_rate_bps;
+#ifdef SIGFOX_EP_UL_BIT_RATE_BPS
+    (void) rfp_test_mode;
+    ul_bit_rate_bps = SIGFOX_EP_UL_BIT_RATE_BPS;
+#else
+    ul_bit_rate_bps = (rfp_test_mode->ul_bit_rate == SIGFOX_UL_BIT_RATE_600BPS) ? 600 : 100;
+#endif
+#ifdef SIGFOX_EP_SINGLE_FRAME
+    number_of_frames = 1;
+#endif
+#ifdef SIGFOX_EP_T_IFU_MS
+    t_ifu_ms = SIGFOX_EP_T_IFU_MS;
+#endif
+    if (number_of_frames == 0) {
+        number_of_frames = 1;
+    }
+    return ((number_of_frames * SIGFOX_RFP_COMMON_get_ul_frame_duration_ms(ul_payload_size_bytes, ul_bit_rate_bps)) + ((number_of_frames - 1) * t_ifu_ms));
+}
+#endif
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_get_application_message_airtime(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Compute the radio activities durations of an application message sent with the test API.
+ * \param[in]   application_message: Message to analyze.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  airtime: Durations of the message radio activities.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_get_application_message_airtime(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime) {
+    // Local variables.
+    sfx_u8 ul_payload_size_bytes = 0;
+    // Reset durations.
+    airtime->tx_ms = 0;
+    airtime->ifu_ms = 0;
+    airtime->t_w_ms = 0;
+    airtime->rx_ms = 0;
+    airtime->tx_power_dbm_eirp = 0;
+    if (application_message->type == SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY) {
+#ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
+        ul_payload_size_bytes = SIGFOX_EP_UL_PAYLOAD_SIZE;
+#else
+        ul_payload_size_bytes = application_message->ul_payload_size_bytes;
+#endif
+    }
+    if (test_param->flags.field.ul_enable != 0) {
+#ifdef SIGFOX_RFP_COMMON_PARAMETERS
+        _get_common_parameters_airtime(&(application_message->common_parameters), ul_payload_size_bytes, airtime);
+#else
+        _get_common_parameters_airtime(ul_payload_size_bytes, airtime);
+#endif
+    }
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    if (application_message->bidirectional_flag != SIGFOX_FALSE) {
+        _get_downlink_airtime(test_param, airtime);
+    }
+#endif
+}
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_get_control_message_airtime(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Compute the radio activities durations of a control message sent with the test API.
+ * \param[in]   control_message: Message to analyze.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  airtime: Durations of the message radio activities.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_get_control_message_airtime(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param, SIGFOX_RFP_COMMON_airtime_t *airtime) {
+    // Reset durations.
+    airtime->tx_ms = 0;
+    airtime->ifu_ms = 0;
+    airtime->t_w_ms = 0;
+    airtime->rx_ms = 0;
+    airtime->tx_power_dbm_eirp = 0;
+    if (test_param->flags.field.ul_enable != 0) {
+#ifdef SIGFOX_RFP_COMMON_PARAMETERS
+        _get_common_parameters_airtime(&(control_message->common_parameters), SIGFOX_RFP_COMMON_KEEP_ALIVE_PAYLOAD_BYTES, airtime);
+#else
+        _get_common_parameters_airtime(SIGFOX_RFP_COMMON_KEEP_ALIVE_PAYLOAD_BYTES, airtime);
+#endif
+    }
+}
+#endif
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_application_message(SIGFOX_EP_API_application_message_t *application_message, SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Send an application message with the test API.
+ * \param[in]   application_message: Message to send.
+ * \param[in]   test_param: Test parameters.
+ * \param[out]  none
+ * \retval      EP library status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_application_message(SIGFOX_EP_API_application_message_t *application_message, SIGFOX_EP_API_TEST_parameters_t *test_param) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING)
+    SIGFOX_RFP_COMMON_airtime_t airtime;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    sfx_u32 deadline_ms = 0;
+    // Start the supervision before sending, the completion may occur at any time.
+    if (sigfox_rfp_common_deadline_ctx.margin_ms != 0) {
+        SIGFOX_RFP_COMMON_get_application_message_airtime(application_message, test_param, &airtime);
+        deadline_ms = _get_deadline_ms(test_param, &airtime);
+    }
+    if (deadline_ms != 0) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        sigfox_ep_api_status = _start_deadline(&(application_message->message_cplt_cb), deadline_ms);
+        if (sigfox_ep_api_status != SIGFOX_EP_API_SUCCESS) {
+            _cancel_deadline(&(application_message->message_cplt_cb));
+            return sigfox_ep_api_status;
+        }
+#else
+        _start_deadline(&(application_message->message_cplt_cb), deadline_ms);
+#endif
+    }
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    // A message blocked by the spectrum access controls is part of the measurement: the test modes do not abort on its network error.
+    SIGFOX_RFP_THROUGHPUT_start_application_message(application_message, test_param);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+    // The send call is timestamped last to exclude the addon processing from the uplink duration.
+    SIGFOX_RFP_COMMON_get_application_message_airtime(application_message, test_param, &airtime);
+    SIGFOX_RFP_UPLINK_TIMING_start_message(&(application_message->uplink_cplt_cb), &(application_message->message_cplt_cb), (airtime.tx_ms + airtime.ifu_ms));
+#endif
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+    _start_message(&(application_message->message_cplt_cb));
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(application_message, test_param);
+    if (sigfox_ep_api_status != SIGFOX_EP_API_SUCCESS) {
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+        _cancel_message(&(application_message->message_cplt_cb));
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+        SIGFOX_RFP_UPLINK_TIMING_cancel_message(&(application_message->uplink_cplt_cb), &(application_message->message_cplt_cb));
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+        if (deadline_ms != 0) {
+            _cancel_deadline(&(application_message->message_cplt_cb));
+        }
+#endif
+        return sigfox_ep_api_status;
+    }
+#else
+    SIGFOX_EP_API_TEST_send_application_message(application_message, test_param);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    SIGFOX_RFP_ENERGY_add_application_message(application_message, test_param);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return sigfox_ep_api_status;
+#endif
+}
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_control_message(SIGFOX_EP_API_control_message_t *control_message, SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Send a control message with the test API.
+ * \param[in]   control_message: Message to send.
+ * \param[in]   test_param: Test parameters.
+ * \param[out]  none
+ * \retval      EP library status.
+ *******************************************************************/
+SIGFOX_EP_API_status_t SIGFOX_RFP_COMMON_send_control_message(SIGFOX_EP_API_control_message_t *control_message, SIGFOX_EP_API_TEST_parameters_t *test_param) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+#endif
+#if (defined SIGFOX_EP_ADDON_RFP_DEADLINE) || (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING)
+    SIGFOX_RFP_COMMON_airtime_t airtime;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+    sfx_u32 deadline_ms = 0;
+    // Start the supervision before sending, the completion may occur at any time.
+    if (sigfox_rfp_common_deadline_ctx.margin_ms != 0) {
+        SIGFOX_RFP_COMMON_get_control_message_airtime(control_message, test_param, &airtime);
+        deadline_ms = _get_deadline_ms(test_param, &airtime);
+    }
+    if (deadline_ms != 0) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        sigfox_ep_api_status = _start_deadline(&(control_message->message_cplt_cb), deadline_ms);
+        if (sigfox_ep_api_status != SIGFOX_EP_API_SUCCESS) {
+            _cancel_deadline(&(control_message->message_cplt_cb));
+            return sigfox_ep_api_status;
+        }
+#else
+        _start_deadline(&(control_message->message_cplt_cb), deadline_ms);
+#endif
+    }
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    SIGFOX_RFP_THROUGHPUT_start_control_message(control_message, test_param);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+    // The send call is timestamped last to exclude the addon processing from the uplink duration.
+    SIGFOX_RFP_COMMON_get_control_message_airtime(control_message, test_param, &airtime);
+    SIGFOX_RFP_UPLINK_TIMING_start_message(&(control_message->uplink_cplt_cb), &(control_message->message_cplt_cb), (airtime.tx_ms + airtime.ifu_ms));
+#endif
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+    _start_message(&(control_message->message_cplt_cb));
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_control_message(control_message, test_param);
+    if (sigfox_ep_api_status != SIGFOX_EP_API_SUCCESS) {
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+        _cancel_message(&(control_message->message_cplt_cb));
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_UPLINK_TIMING
+        SIGFOX_RFP_UPLINK_TIMING_cancel_message(&(control_message->uplink_cplt_cb), &(control_message->message_cplt_cb));
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+        if (deadline_ms != 0) {
+            _cancel_deadline(&(control_message->message_cplt_cb));
+        }
+#endif
+        return sigfox_ep_api_status;
+    }
+#else
+    SIGFOX_EP_API_TEST_send_control_message(control_message, test_param);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    SIGFOX_RFP_ENERGY_add_control_message(control_message, test_param);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return sigfox_ep_api_status;
+#endif
+}
+#endif
+
+#ifdef SIGFOX_RFP_COMMON_MESSAGE_TRACKING
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_reset_message(void)
+ * \brief Forget the message in progress (EP library opened again).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_reset_message(void) {
+    sigfox_rfp_common_message_ctx.message_cplt_cb = SIGFOX_NULL;
+    sigfox_rfp_common_message_ctx.message_dropped_cb = SIGFOX_NULL;
+    sigfox_rfp_common_message_ctx.message_pending = SIGFOX_FALSE;
+}
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_RFP_COMMON_drop_message(SIGFOX_RFP_COMMON_message_dropped_cb_t message_dropped_cb)
+ * \brief Discard the completion of the message in progress, so that it does not reach the aborted test mode.
+ * \param[in]   message_dropped_cb: Called instead of the test mode callback when the message is completed.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if a message is in progress in the EP library, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_RFP_COMMON_drop_message(SIGFOX_RFP_COMMON_message_dropped_cb_t message_dropped_cb) {
+    if (sigfox_rfp_common_message_ctx.message_pending == SIGFOX_FALSE) {
+        return SIGFOX_FALSE;
+    }
+    sigfox_rfp_common_message_ctx.message_dropped_cb = message_dropped_cb;
+    return SIGFOX_TRUE;
+}
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_RFP_COMMON_is_message_pending(void)
+ * \brief Check if a message sent by a test mode is still in progress in the EP library.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the message completion has not been received yet, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_RFP_COMMON_is_message_pending(void) {
+    return sigfox_rfp_common_message_ctx.message_pending;
+}
+#endif
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_COMMON_timer_start(MCU_API_timer_t *timer)
+ * \brief Start the addon timer.
+ * \param[in]   timer: Timer parameters.
+ * \param[out]  none
+ * \retval      MCU driver status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_COMMON_timer_start(MCU_API_timer_t *timer) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+    mcu_api_status = _TIMER_START(timer);
+    if (mcu_api_status != MCU_API_SUCCESS) {
+        return mcu_api_status;
+    }
+#else
+    _TIMER_START(timer);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    SIGFOX_RFP_ENERGY_start_window(timer->duration_ms);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return mcu_api_status;
+#endif
+}
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_COMMON_timer_stop(void)
+ * \brief Stop the addon timer.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      MCU driver status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_COMMON_timer_stop(void) {
+#ifdef SIGFOX_EP_ADDON_RFP_ENERGY
+    SIGFOX_RFP_ENERGY_stop_window();
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    return _TIMER_STOP();
+#else
+    _TIMER_STOP();
+#endif
+}
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_COMMON_timer_wait_cplt(SIGFOX_RFP_COMMON_timer_cplt_cb_t timer_cplt_cb)
+ * \brief Wait for the addon timer expiration. In blocking mode, the function waits for the timer and calls the given completion callback.
+ * \brief In asynchronous mode, the callback is called by the timer itself and the function returns immediately.
+ * \param[in]   timer_cplt_cb: Timer completion callback of the test mode.
+ * \param[out]  none
+ * \retval      MCU driver status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_COMMON_timer_wait_cplt(SIGFOX_RFP_COMMON_timer_cplt_cb_t timer_cplt_cb) {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    // Timer completion is notified by the MCU driver.
+    (void) timer_cplt_cb;
+#ifdef SIGFOX_EP_ERROR_CODES
+    return MCU_API_SUCCESS;
+#endif
+#else
+#ifdef SIGFOX_EP_ERROR_CODES
+    // Local variables.
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+    mcu_api_status = _TIMER_WAIT_CPLT();
+    if (mcu_api_status != MCU_API_SUCCESS) {
+        return mcu_api_status;
+    }
+#else
+    _TIMER_WAIT_CPLT();
+#endif
+    timer_cplt_cb();
+#ifdef SIGFOX_EP_ERROR_CODES
+    return mcu_api_status;
+#endif
+#endif
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_DEADLINE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_COMMON_set_step_deadline(sfx_u32 margin_ms, SIGFOX_RFP_COMMON_deadline_cb_t deadline_cb)
+ * \brief Configure the supervision of the messages sent by the test modes.
+ * \brief Each message has to be completed within its on-air time plus the given margin, otherwise the deadline callback is called and the message completion is discarded.
+ * \param[in]   margin_ms: Margin added to the on-air time of each message (0 to disable the supervision).
+ * \param[in]   deadline_cb: Called when a message is not completed in time.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_COMMON_set_step_deadline(sfx_u32 margin_ms, SIGFOX_RFP_COMMON_deadline_cb_t deadline_cb) {
+    sigfox_rfp_common_deadline_ctx.margin_ms = margin_ms;
+    sigfox_rfp_common_deadline_ctx.deadline_cb = deadline_cb;
+    sigfox_rfp_common_deadline_ctx.message_cplt_cb = SIGFOX_NULL;
+}
+#endif
+
+#endif /* SIGFOX_EP_CERTIFICATION */
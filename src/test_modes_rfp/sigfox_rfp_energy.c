@@ -0,0 +1,273 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_energy.c
+ * \brief   Sigfox addon RF & Protocol energy accounting
+ * \details This file integrates the time spent in each radio state during a test mode
+ *          and converts it into charge using the user energy model.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "test_modes_rfp/sigfox_rfp_energy.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_ENERGY)
+
+/*** SIGFOX RFP ENERGY local macros ***/
+
+#define SIGFOX_RFP_ENERGY_UA_MS_PER_UAH     3600000
+// Integration step keeping current * duration within 32 bits.
+#define SIGFOX_RFP_ENERGY_STEP_MS           1000
+
+/*** SIGFOX RFP ENERGY local structures ***/
+
+typedef struct {
+    const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model;
+    sfx_u32 time_ms[SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST];
+    sfx_u32 charge_uah[SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST];
+    sfx_u32 charge_residue_ua_ms[SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST];
+    sfx_u32 window_ms;
+    sfx_u32 window_busy_ms;
+    sfx_u8 window_open;
+} SIGFOX_RFP_ENERGY_context_t;
+
+/*** SIGFOX RFP ENERGY local global variables ***/
+
+static SIGFOX_RFP_ENERGY_context_t sigfox_rfp_energy_ctx;
+
+/*** SIGFOX RFP ENERGY local functions ***/
+
+/*!******************************************************************
+ * \fn static sfx_u32 _get_current_ua(SIGFOX_EP_ADDON_RFP_API_radio_state_t radio_state, sfx_s8 tx_power_dbm_eirp)
+ * \brief Get the current of a radio state from the energy model.
+ * \param[in]   radio_state: Radio state.
+ * \param[in]   tx_power_dbm_eirp: TX power, only used in TX state.
+ * \param[out]  none
+ * \retval      Current in uA, 0 if not given by the model.
+ *******************************************************************/
+static sfx_u32 _get_current_ua(SIGFOX_EP_ADDON_RFP_API_radio_state_t radio_state, sfx_s8 tx_power_dbm_eirp) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model = sigfox_rfp_energy_ctx.energy_model;
+    sfx_u32 current_ua = 0;
+    sfx_s16 delta = 0;
+    sfx_s16 best_delta = 0x7FFF;
+    sfx_u8 idx = 0;
+    if (energy_model == SIGFOX_NULL) {
+        return 0;
+    }
+    switch (radio_state) {
+    case SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_TX:
+        if (energy_model->tx_current_table == SIGFOX_NULL) {
+            break;
+        }
+        // Use the closest TX power of the table, rounding up on ties.
+        for (idx = 0; idx < (energy_model->tx_current_table_size); idx++) {
+            delta = (sfx_s16) ((energy_model->tx_current_table[idx]).tx_power_dbm_eirp - tx_power_dbm_eirp);
+            if (delta < 0) {
+                delta = (sfx_s16) (-delta);
+            }
+            if ((delta < best_delta) || ((delta == best_delta) && ((energy_model->tx_current_table[idx]).tx_power_dbm_eirp > tx_power_dbm_eirp))) {
+                best_delta = delta;
+                current_ua = (energy_model->tx_current_table[idx]).current_ua;
+            }
+        }
+        break;
+    case SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_RX:
+        current_ua = energy_model->rx_current_ua;
+        break;
+    case SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_IDLE:
+        current_ua = energy_model->idle_current_ua;
+        break;
+    case SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_SLEEP:
+        current_ua = energy_model->sleep_current_ua;
+        break;
+    default:
+        break;
+    }
+    return current_ua;
+}
+
+/*!******************************************************************
+ * \fn static void _add_state(SIGFOX_EP_ADDON_RFP_API_radio_state_t radio_state, sfx_u32 duration_ms, sfx_s8 tx_power_dbm_eirp)
+ * \brief Add a radio state duration to the energy counters.
+ * \param[in]   radio_state: Radio state.
+ * \param[in]   duration_ms: Duration of the state.
+ * \param[in]   tx_power_dbm_eirp: TX power, only used in TX state.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _add_state(SIGFOX_EP_ADDON_RFP_API_radio_state_t radio_state, sfx_u32 duration_ms, sfx_s8 tx_power_dbm_eirp) {
+    // Local variables.
+    sfx_u32 current_ua = _get_current_ua(radio_state, tx_power_dbm_eirp);
+    sfx_u32 step_ms = 0;
+    sfx_u32 *residue = &(sigfox_rfp_energy_ctx.charge_residue_ua_ms[radio_state]);
+    sigfox_rfp_energy_ctx.time_ms[radio_state] += duration_ms;
+    if (current_ua == 0) {
+        return;
+    }
+    while (duration_ms > 0) {
+        step_ms = (duration_ms > SIGFOX_RFP_ENERGY_STEP_MS) ? SIGFOX_RFP_ENERGY_STEP_MS : duration_ms;
+        (*residue) += current_ua * step_ms;
+        sigfox_rfp_energy_ctx.charge_uah[radio_state] += (*residue) / SIGFOX_RFP_ENERGY_UA_MS_PER_UAH;
+        (*residue) %= SIGFOX_RFP_ENERGY_UA_MS_PER_UAH;
+        duration_ms -= step_ms;
+    }
+}
+
+/*!******************************************************************
+ * \fn static void _add_airtime(SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Add the radio activities of a message to the energy counters.
+ * \param[in]   airtime: Durations of the message radio activities.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _add_airtime(SIGFOX_RFP_COMMON_airtime_t *airtime) {
+    _add_state(SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_TX, airtime->tx_ms, airtime->tx_power_dbm_eirp);
+    _add_state(SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_IDLE, (airtime->ifu_ms + airtime->t_w_ms), 0);
+    _add_state(SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_RX, airtime->rx_ms, 0);
+    if (sigfox_rfp_energy_ctx.window_open != 0) {
+        sigfox_rfp_energy_ctx.window_busy_ms += airtime->tx_ms + airtime->ifu_ms + airtime->t_w_ms + airtime->rx_ms;
+    }
+}
+
+/*** SIGFOX RFP ENERGY functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_reset(const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model)
+ * \brief Reset the accounting and select the energy model to use.
+ * \param[in]   energy_model: Currents of the radio states (NULL to only account durations).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_reset(const SIGFOX_EP_ADDON_RFP_API_energy_model_t *energy_model) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    sigfox_rfp_energy_ctx.energy_model = energy_model;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST; idx++) {
+        sigfox_rfp_energy_ctx.time_ms[idx] = 0;
+        sigfox_rfp_energy_ctx.charge_uah[idx] = 0;
+        sigfox_rfp_energy_ctx.charge_residue_ua_ms[idx] = 0;
+    }
+    sigfox_rfp_energy_ctx.window_ms = 0;
+    sigfox_rfp_energy_ctx.window_busy_ms = 0;
+    sigfox_rfp_energy_ctx.window_open = 0;
+}
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_add_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Account the radio activities of an application message.
+ * \param[in]   application_message: Message sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_add_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param) {
+    // Local variables.
+    SIGFOX_RFP_COMMON_airtime_t airtime;
+    SIGFOX_RFP_COMMON_get_application_message_airtime(application_message, test_param, &airtime);
+    _add_airtime(&airtime);
+}
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_add_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Account the radio activities of a control message.
+ * \param[in]   control_message: Message sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_add_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param) {
+    // Local variables.
+    SIGFOX_RFP_COMMON_airtime_t airtime;
+    SIGFOX_RFP_COMMON_get_control_message_airtime(control_message, test_param, &airtime);
+    _add_airtime(&airtime);
+}
+#endif
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_start_window(sfx_u32 duration_ms)
+ * \brief Open a timing window. The part of the window which is not used by the radio is accounted as sleep.
+ * \param[in]   duration_ms: Window duration.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_start_window(sfx_u32 duration_ms) {
+    SIGFOX_RFP_ENERGY_stop_window();
+    sigfox_rfp_energy_ctx.window_ms = duration_ms;
+    sigfox_rfp_energy_ctx.window_busy_ms = 0;
+    sigfox_rfp_energy_ctx.window_open = 1;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_stop_window(void)
+ * \brief Close the current timing window, if any.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_stop_window(void) {
+    if (sigfox_rfp_energy_ctx.window_open == 0) {
+        return;
+    }
+    if (sigfox_rfp_energy_ctx.window_ms > sigfox_rfp_energy_ctx.window_busy_ms) {
+        _add_state(SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_SLEEP, (sigfox_rfp_energy_ctx.window_ms - sigfox_rfp_energy_ctx.window_busy_ms), 0);
+    }
+    sigfox_rfp_energy_ctx.window_open = 0;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_ENERGY_get_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report)
+ * \brief Get the accounting of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  energy_report: Time spent and charge consumed in each radio state.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_ENERGY_get_report(SIGFOX_EP_ADDON_RFP_API_energy_report_t *energy_report) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    energy_report->total_charge_uah = 0;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_RFP_API_RADIO_STATE_LAST; idx++) {
+        energy_report->time_ms[idx] = sigfox_rfp_energy_ctx.time_ms[idx];
+        energy_report->charge_uah[idx] = sigfox_rfp_energy_ctx.charge_uah[idx];
+        energy_report->total_charge_uah += sigfox_rfp_energy_ctx.charge_uah[idx];
+    }
+}
+
+#endif /* SIGFOX_EP_CERTIFICATION && SIGFOX_EP_ADDON_RFP_ENERGY */
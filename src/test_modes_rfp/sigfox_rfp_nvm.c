@@ -0,0 +1,193 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_nvm.c
+ * \brief   Sigfox addon RF & Protocol NVM stress measurement
+ * \details This file accounts the NVM writes reported by the MCU port and checks the
+ *          message counter stored in NVM after each message of the test mode L stress cycles.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include "test_modes_rfp/sigfox_rfp_nvm.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_NVM_STRESS)
+
+/*** SIGFOX RFP NVM local macros ***/
+
+// Smallest message counter rollover value supported by the EP library.
+#define SIGFOX_RFP_NVM_MESSAGE_COUNTER_ROLLOVER_MIN     128
+// Largest value of a 32 bits unsigned integer, reported when the mean write time does not fit.
+#define SIGFOX_RFP_NVM_U32_MAX                          0xFFFFFFFF
+// Largest milliseconds value which can be converted to microseconds within 32 bits.
+#define SIGFOX_RFP_NVM_MS_TO_US_MAX                     ((SIGFOX_RFP_NVM_U32_MAX - 999) / 1000)
+
+/*** SIGFOX RFP NVM local structures ***/
+
+typedef struct {
+    sfx_u32 number_of_writes;
+    sfx_u32 write_time_min_us;
+    sfx_u32 write_time_max_us;
+    sfx_u32 write_time_total_ms;
+    sfx_u32 write_time_total_us; /*!< Below 1 ms, carried into write_time_total_ms */
+    sfx_u32 write_time_histogram[SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE];
+    sfx_u16 number_of_cycles;
+    sfx_u16 number_of_counter_errors;
+    sfx_u16 message_counter;
+} SIGFOX_RFP_NVM_context_t;
+
+/*** SIGFOX RFP NVM local global variables ***/
+
+// Upper bound of each class of the write time histogram, the last class has no bound.
+static const sfx_u32 SIGFOX_RFP_NVM_HISTOGRAM_BOUNDS_US[SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE - 1] = {100, 500, 1000, 5000, 10000, 50000, 100000};
+
+static SIGFOX_RFP_NVM_context_t sigfox_rfp_nvm_ctx;
+
+/*** SIGFOX RFP NVM functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_reset(sfx_u16 message_counter)
+ * \brief Reset the measurement.
+ * \param[in]   message_counter: Message counter read in NVM before the first cycle.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_reset(sfx_u16 message_counter) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    sigfox_rfp_nvm_ctx.number_of_writes = 0;
+    sigfox_rfp_nvm_ctx.write_time_min_us = 0;
+    sigfox_rfp_nvm_ctx.write_time_max_us = 0;
+    sigfox_rfp_nvm_ctx.write_time_total_ms = 0;
+    sigfox_rfp_nvm_ctx.write_time_total_us = 0;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE; idx++) {
+        sigfox_rfp_nvm_ctx.write_time_histogram[idx] = 0;
+    }
+    sigfox_rfp_nvm_ctx.number_of_cycles = 0;
+    sigfox_rfp_nvm_ctx.number_of_counter_errors = 0;
+    sigfox_rfp_nvm_ctx.message_counter = message_counter;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_add_write(sfx_u32 write_time_us)
+ * \brief Account one NVM write.
+ * \param[in]   write_time_us: Duration of the write.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_add_write(sfx_u32 write_time_us) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    if ((sigfox_rfp_nvm_ctx.number_of_writes == 0) || (write_time_us < sigfox_rfp_nvm_ctx.write_time_min_us)) {
+        sigfox_rfp_nvm_ctx.write_time_min_us = write_time_us;
+    }
+    if (write_time_us > sigfox_rfp_nvm_ctx.write_time_max_us) {
+        sigfox_rfp_nvm_ctx.write_time_max_us = write_time_us;
+    }
+    sigfox_rfp_nvm_ctx.number_of_writes++;
+    sigfox_rfp_nvm_ctx.write_time_total_ms += write_time_us / 1000;
+    sigfox_rfp_nvm_ctx.write_time_total_us += write_time_us % 1000;
+    if (sigfox_rfp_nvm_ctx.write_time_total_us >= 1000) {
+        sigfox_rfp_nvm_ctx.write_time_total_ms++;
+        sigfox_rfp_nvm_ctx.write_time_total_us -= 1000;
+    }
+    while ((idx < (SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE - 1)) && (write_time_us >= SIGFOX_RFP_NVM_HISTOGRAM_BOUNDS_US[idx])) {
+        idx++;
+    }
+    sigfox_rfp_nvm_ctx.write_time_histogram[idx]++;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_add_cycle(sfx_u16 message_counter)
+ * \brief Account one completed message and check the message counter stored in NVM.
+ * \param[in]   message_counter: Message counter read in NVM after the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_add_cycle(sfx_u16 message_counter) {
+    // Local variables.
+    sfx_u16 expected_message_counter = (sfx_u16) (sigfox_rfp_nvm_ctx.message_counter + 1);
+    sigfox_rfp_nvm_ctx.number_of_cycles++;
+    // The rollover value is not known here: any return to 0 from a counter above the smallest rollover is accepted.
+    if ((message_counter != expected_message_counter) && ((message_counter != 0) || (expected_message_counter < SIGFOX_RFP_NVM_MESSAGE_COUNTER_ROLLOVER_MIN))) {
+        sigfox_rfp_nvm_ctx.number_of_counter_errors++;
+    }
+    sigfox_rfp_nvm_ctx.message_counter = message_counter;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_NVM_get_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report)
+ * \brief Get the measurement of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  nvm_report: Write count, write time distribution and counter consistency.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_NVM_get_report(SIGFOX_EP_ADDON_RFP_API_nvm_report_t *nvm_report) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    sfx_u32 number_of_writes = sigfox_rfp_nvm_ctx.number_of_writes;
+    sfx_u32 quotient_ms = 0;
+    sfx_u32 remainder_ms = 0;
+    nvm_report->number_of_cycles = sigfox_rfp_nvm_ctx.number_of_cycles;
+    nvm_report->number_of_counter_errors = sigfox_rfp_nvm_ctx.number_of_counter_errors;
+    nvm_report->message_counter = sigfox_rfp_nvm_ctx.message_counter;
+    nvm_report->number_of_writes = number_of_writes;
+    nvm_report->write_time_min_us = sigfox_rfp_nvm_ctx.write_time_min_us;
+    nvm_report->write_time_max_us = sigfox_rfp_nvm_ctx.write_time_max_us;
+    nvm_report->write_time_mean_us = 0;
+    if (number_of_writes != 0) {
+        // Split to keep the intermediate products within 32 bits.
+        quotient_ms = sigfox_rfp_nvm_ctx.write_time_total_ms / number_of_writes;
+        remainder_ms = sigfox_rfp_nvm_ctx.write_time_total_ms % number_of_writes;
+        if (quotient_ms > SIGFOX_RFP_NVM_MS_TO_US_MAX) {
+            nvm_report->write_time_mean_us = SIGFOX_RFP_NVM_U32_MAX;
+        }
+        else if (remainder_ms <= SIGFOX_RFP_NVM_MS_TO_US_MAX) {
+            nvm_report->write_time_mean_us = (quotient_ms * 1000) + (((remainder_ms * 1000) + sigfox_rfp_nvm_ctx.write_time_total_us) / number_of_writes);
+        }
+        else {
+            // Remainder part below 1 ms, computed on the number of writes divided by 1000 (above 4294 in this case).
+            remainder_ms /= (number_of_writes / 1000);
+            nvm_report->write_time_mean_us = (quotient_ms * 1000) + ((remainder_ms < 1000) ? remainder_ms : 999);
+        }
+    }
+    for (idx = 0; idx < SIGFOX_EP_ADDON_RFP_API_NVM_HISTOGRAM_SIZE; idx++) {
+        nvm_report->write_time_histogram[idx] = sigfox_rfp_nvm_ctx.write_time_histogram[idx];
+    }
+}
+
+#endif /* SIGFOX_EP_CERTIFICATION && SIGFOX_EP_ADDON_RFP_NVM_STRESS */
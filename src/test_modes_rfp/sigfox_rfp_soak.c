@@ -0,0 +1,281 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_soak.c
+ * \brief   Sigfox addon RF & Protocol soak statistics
+ * \details This file keeps constant size statistics of the messages and timing windows
+ *          of the test modes B and J, which can be read while the test mode is running.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include "test_modes_rfp/sigfox_rfp_soak.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_SOAK)
+
+/*** SIGFOX RFP SOAK local structures ***/
+
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms;
+    sfx_u32 window_start_ms;
+    sfx_u32 window_duration_ms;
+    sfx_u32 message_start_ms;
+    sfx_u32 message_latency_ms;
+    sfx_u32 number_of_iterations;
+    sfx_u32 number_of_windows;
+    sfx_u32 number_of_messages;
+    sfx_u32 number_of_execution_errors;
+    sfx_u32 number_of_network_errors;
+    sfx_u32 latency_min_ms;
+    sfx_u32 latency_max_ms;
+    sfx_u32 lateness_max_ms;
+    SIGFOX_EP_ADDON_RFP_API_soak_window_t current_window;
+    // Ring buffer of the last completed windows, window_idx is the next entry to write.
+    SIGFOX_EP_ADDON_RFP_API_soak_window_t window[SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS];
+    sfx_u8 window_idx;
+    sfx_u8 window_started;
+    sfx_u8 message_started;
+    sfx_u8 message_cplt;
+} SIGFOX_RFP_SOAK_context_t;
+
+/*** SIGFOX RFP SOAK local global variables ***/
+
+static SIGFOX_RFP_SOAK_context_t sigfox_rfp_soak_ctx;
+
+/*** SIGFOX RFP SOAK local functions ***/
+
+/*!******************************************************************
+ * \fn static sfx_u32 _get_time_ms(void)
+ * \brief Read the time source.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current time in ms, 0 if there is no time source.
+ *******************************************************************/
+static sfx_u32 _get_time_ms(void) {
+    return (sigfox_rfp_soak_ctx.get_time_ms != SIGFOX_NULL) ? sigfox_rfp_soak_ctx.get_time_ms() : 0;
+}
+
+/*!******************************************************************
+ * \fn static void _reset_current_window(void)
+ * \brief Start a new window.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _reset_current_window(void) {
+    sigfox_rfp_soak_ctx.current_window.window_index = sigfox_rfp_soak_ctx.number_of_windows;
+    sigfox_rfp_soak_ctx.current_window.lateness_ms = 0;
+    sigfox_rfp_soak_ctx.current_window.latency_max_ms = 0;
+    sigfox_rfp_soak_ctx.current_window.number_of_messages = 0;
+    sigfox_rfp_soak_ctx.current_window.number_of_errors = 0;
+}
+
+/*** SIGFOX RFP SOAK functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms)
+ * \brief Reset the statistics.
+ * \param[in]   get_time_ms: Time source of the addon.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms) {
+    sigfox_rfp_soak_ctx.get_time_ms = get_time_ms;
+    sigfox_rfp_soak_ctx.window_start_ms = 0;
+    sigfox_rfp_soak_ctx.window_duration_ms = 0;
+    sigfox_rfp_soak_ctx.message_start_ms = 0;
+    sigfox_rfp_soak_ctx.message_latency_ms = 0;
+    sigfox_rfp_soak_ctx.number_of_iterations = 0;
+    sigfox_rfp_soak_ctx.number_of_windows = 0;
+    sigfox_rfp_soak_ctx.number_of_messages = 0;
+    sigfox_rfp_soak_ctx.number_of_execution_errors = 0;
+    sigfox_rfp_soak_ctx.number_of_network_errors = 0;
+    sigfox_rfp_soak_ctx.latency_min_ms = 0;
+    sigfox_rfp_soak_ctx.latency_max_ms = 0;
+    sigfox_rfp_soak_ctx.lateness_max_ms = 0;
+    sigfox_rfp_soak_ctx.window_idx = 0;
+    sigfox_rfp_soak_ctx.window_started = 0;
+    sigfox_rfp_soak_ctx.message_started = 0;
+    sigfox_rfp_soak_ctx.message_cplt = 0;
+    _reset_current_window();
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_start_window(sfx_u32 window_duration_ms)
+ * \brief Account the start of a timing window.
+ * \param[in]   window_duration_ms: Planned duration of the window.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_start_window(sfx_u32 window_duration_ms) {
+    sigfox_rfp_soak_ctx.window_start_ms = _get_time_ms();
+    sigfox_rfp_soak_ctx.window_duration_ms = window_duration_ms;
+    sigfox_rfp_soak_ctx.window_started = 1;
+    _reset_current_window();
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_end_window(void)
+ * \brief Account the end of the current timing window and compute its lateness.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_end_window(void) {
+    // Local variables.
+    sfx_u32 elapsed_ms = 0;
+    if (sigfox_rfp_soak_ctx.window_started == 0) {
+        return;
+    }
+    sigfox_rfp_soak_ctx.window_started = 0;
+    // Unsigned difference to support the wrapping of the time source.
+    elapsed_ms = _get_time_ms() - sigfox_rfp_soak_ctx.window_start_ms;
+    if (elapsed_ms > sigfox_rfp_soak_ctx.window_duration_ms) {
+        sigfox_rfp_soak_ctx.current_window.lateness_ms = elapsed_ms - sigfox_rfp_soak_ctx.window_duration_ms;
+    }
+    if (sigfox_rfp_soak_ctx.current_window.lateness_ms > sigfox_rfp_soak_ctx.lateness_max_ms) {
+        sigfox_rfp_soak_ctx.lateness_max_ms = sigfox_rfp_soak_ctx.current_window.lateness_ms;
+    }
+    sigfox_rfp_soak_ctx.window[sigfox_rfp_soak_ctx.window_idx] = sigfox_rfp_soak_ctx.current_window;
+    sigfox_rfp_soak_ctx.window_idx = (sfx_u8) ((sigfox_rfp_soak_ctx.window_idx + 1) % SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS);
+    sigfox_rfp_soak_ctx.number_of_windows++;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_end_iteration(void)
+ * \brief Account a completed pass of the message catalogue.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_end_iteration(void) {
+    sigfox_rfp_soak_ctx.number_of_iterations++;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_start_message(void)
+ * \brief Account a message request.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_start_message(void) {
+    sigfox_rfp_soak_ctx.message_start_ms = _get_time_ms();
+    sigfox_rfp_soak_ctx.message_started = 1;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_message_cplt(void)
+ * \brief Account the completion of the requested message. To be called from the message completion callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_message_cplt(void) {
+    if (sigfox_rfp_soak_ctx.message_started == 0) {
+        return;
+    }
+    sigfox_rfp_soak_ctx.message_started = 0;
+    sigfox_rfp_soak_ctx.message_latency_ms = _get_time_ms() - sigfox_rfp_soak_ctx.message_start_ms;
+    sigfox_rfp_soak_ctx.message_cplt = 1;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_add_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Account the status of the completed message.
+ * \param[in]   message_status: Status reported by the EP library.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_add_message_status(SIGFOX_EP_API_message_status_t message_status) {
+    if (sigfox_rfp_soak_ctx.message_cplt == 0) {
+        return;
+    }
+    sigfox_rfp_soak_ctx.message_cplt = 0;
+    if ((sigfox_rfp_soak_ctx.number_of_messages == 0) || (sigfox_rfp_soak_ctx.message_latency_ms < sigfox_rfp_soak_ctx.latency_min_ms)) {
+        sigfox_rfp_soak_ctx.latency_min_ms = sigfox_rfp_soak_ctx.message_latency_ms;
+    }
+    if (sigfox_rfp_soak_ctx.message_latency_ms > sigfox_rfp_soak_ctx.latency_max_ms) {
+        sigfox_rfp_soak_ctx.latency_max_ms = sigfox_rfp_soak_ctx.message_latency_ms;
+    }
+    if (sigfox_rfp_soak_ctx.message_latency_ms > sigfox_rfp_soak_ctx.current_window.latency_max_ms) {
+        sigfox_rfp_soak_ctx.current_window.latency_max_ms = sigfox_rfp_soak_ctx.message_latency_ms;
+    }
+    sigfox_rfp_soak_ctx.number_of_messages++;
+    if (sigfox_rfp_soak_ctx.current_window.number_of_messages < 0xFF) {
+        sigfox_rfp_soak_ctx.current_window.number_of_messages++;
+    }
+    if (message_status.field.execution_error == 1) {
+        sigfox_rfp_soak_ctx.number_of_execution_errors++;
+    }
+    if (message_status.field.network_error == 1) {
+        sigfox_rfp_soak_ctx.number_of_network_errors++;
+    }
+    if (((message_status.field.execution_error == 1) || (message_status.field.network_error == 1)) && (sigfox_rfp_soak_ctx.current_window.number_of_errors < 0xFF)) {
+        sigfox_rfp_soak_ctx.current_window.number_of_errors++;
+    }
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_SOAK_get_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report)
+ * \brief Get the statistics of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  soak_report: Message, error and window statistics.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_SOAK_get_report(SIGFOX_EP_ADDON_RFP_API_soak_report_t *soak_report) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    sfx_u8 window_idx = sigfox_rfp_soak_ctx.window_idx;
+    soak_report->number_of_iterations = sigfox_rfp_soak_ctx.number_of_iterations;
+    soak_report->number_of_windows = sigfox_rfp_soak_ctx.number_of_windows;
+    soak_report->number_of_messages = sigfox_rfp_soak_ctx.number_of_messages;
+    soak_report->number_of_execution_errors = sigfox_rfp_soak_ctx.number_of_execution_errors;
+    soak_report->number_of_network_errors = sigfox_rfp_soak_ctx.number_of_network_errors;
+    soak_report->latency_min_ms = sigfox_rfp_soak_ctx.latency_min_ms;
+    soak_report->latency_max_ms = sigfox_rfp_soak_ctx.latency_max_ms;
+    soak_report->lateness_max_ms = sigfox_rfp_soak_ctx.lateness_max_ms;
+    soak_report->number_of_recent_windows = (sigfox_rfp_soak_ctx.number_of_windows < SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS) ? (sfx_u8) sigfox_rfp_soak_ctx.number_of_windows : SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS;
+    // Copy the ring buffer backwards from the last written entry.
+    for (idx = 0; idx < soak_report->number_of_recent_windows; idx++) {
+        window_idx = (sfx_u8) ((window_idx + SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS - 1) % SIGFOX_EP_ADDON_RFP_API_SOAK_WINDOWS);
+        soak_report->window[idx] = sigfox_rfp_soak_ctx.window[window_idx];
+    }
+}
+
+#endif /* SIGFOX_EP_CERTIFICATION && SIGFOX_EP_ADDON_RFP_SOAK */
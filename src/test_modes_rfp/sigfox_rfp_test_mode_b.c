@@ -39,9 +39,22 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "manuf/mcu_api.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+#include "test_modes_rfp/sigfox_rfp_throughput.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+#include "test_modes_rfp/sigfox_rfp_soak.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 #ifdef SIGFOX_EP_CERTIFICATION
 
 #define LOOP 100
@@ -49,6 +62,20 @@
 #define WINDOW_TIME_MS 18000
 #define START_PAYLOAD 0x40
 
+// Spectrum access controls are disabled unless the throughput is measured under regulatory constraints.
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+#define TX_CONTROL_ENABLE (sigfox_rfp_test_mode_b_ctx.test_mode.regulatory_controls)
+#else
+#define TX_CONTROL_ENABLE SIGFOX_FALSE
+#endif
+
+// Message errors are counted instead of ending a soaked test mode.
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+#define SOAK_ENABLE (sigfox_rfp_test_mode_b_ctx.test_mode.soak)
+#else
+#define SOAK_ENABLE SIGFOX_FALSE
+#endif
+
 typedef struct {
     struct {
         sfx_u8 ep_api_message_cplt    : 1;
@@ -64,11 +91,17 @@ typedef struct {
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_B_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_B_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_B_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_B_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_B_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_B_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_B_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_B_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_B_plan_fn,
+#endif
 };
 
 static SIGFOX_RFP_TEST_MODE_B_context_t sigfox_rfp_test_mode_b_ctx = {
@@ -85,6 +118,15 @@ static SIGFOX_RFP_TEST_MODE_B_context_t sigfox_rfp_test_mode_b_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .test_mode.process_cb           = SIGFOX_NULL,
     .test_mode.cplt_cb              = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    .test_mode.checkpoint_cb        = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    .test_mode.regulatory_controls  = SIGFOX_FALSE,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    .test_mode.soak                 = SIGFOX_FALSE,
 #endif
     .loop_iter                      = 0,
     .cnt_message                    = 0,
@@ -100,6 +142,12 @@ static SIGFOX_RFP_TEST_MODE_B_context_t sigfox_rfp_test_mode_b_ctx = {
  * \retval      none
  *******************************************************************/
 static void _SIGFOX_EP_API_message_cplt_cb(void) {
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    SIGFOX_RFP_THROUGHPUT_message_cplt();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    SIGFOX_RFP_SOAK_message_cplt();
+#endif
     sigfox_rfp_test_mode_b_ctx.flags.ep_api_message_cplt = 1;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     if (sigfox_rfp_test_mode_b_ctx.test_mode.process_cb != SIGFOX_NULL) {
@@ -173,14 +221,14 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #endif
     test_param.flags.all = 0xFF;
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_FH)
-    test_param.flags.field.tx_control_fh_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_fh_enable = TX_CONTROL_ENABLE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
     test_param.lbt_cs_max_duration_first_frame_ms = 0;
-    test_param.flags.field.tx_control_lbt_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_lbt_enable = TX_CONTROL_ENABLE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)
-    test_param.flags.field.tx_control_ldc_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_ldc_enable = TX_CONTROL_ENABLE;
 #endif
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
 #ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
@@ -204,20 +252,23 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     application_message.uplink_cplt_cb = SIGFOX_NULL;
     application_message.message_cplt_cb = &_SIGFOX_EP_API_message_cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    SIGFOX_RFP_SOAK_start_message();
 #endif
     // Send Application message
 #ifdef SIGFOX_EP_ERROR_CODES
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
@@ -243,12 +294,15 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _start_timer(void) {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     timer.cplt_cb = &_MCU_API_timer_cplt_cb;
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    SIGFOX_RFP_SOAK_start_window(WINDOW_TIME_MS);
+#endif
 #ifdef SIGFOX_EP_ERROR_CODES
     // Start timer
-    mcu_api_status = MCU_API_timer_start(&timer);
+    mcu_api_status = SIGFOX_RFP_COMMON_timer_start(&timer);
     MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-    MCU_API_timer_start(&timer);
+    SIGFOX_RFP_COMMON_timer_start(&timer);
 #endif
 #ifdef SIGFOX_EP_ERROR_CODES
 errors:
@@ -289,11 +343,25 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_B_init_fn(SIGFOX_RF
     sigfox_rfp_test_mode_b_ctx.test_mode.ul_bit_rate = rfp_test_mode->ul_bit_rate;
 #endif
 #ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
-    sigfox_rfp_test_mode_b_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp,
+    sigfox_rfp_test_mode_b_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp;
 #endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     sigfox_rfp_test_mode_b_ctx.test_mode.process_cb = rfp_test_mode->process_cb;
     sigfox_rfp_test_mode_b_ctx.test_mode.cplt_cb = rfp_test_mode->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    sigfox_rfp_test_mode_b_ctx.test_mode.regulatory_controls = rfp_test_mode->regulatory_controls;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    sigfox_rfp_test_mode_b_ctx.test_mode.soak = rfp_test_mode->soak;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    // Windows are independent: resume after the last completed one.
+    if (rfp_test_mode->start_step < LOOP) {
+        sigfox_rfp_test_mode_b_ctx.loop_iter = rfp_test_mode->start_step;
+        sigfox_rfp_test_mode_b_ctx.progress_status.progress = (sfx_u8) ((100 * rfp_test_mode->start_step) / LOOP);
+    }
+    sigfox_rfp_test_mode_b_ctx.test_mode.checkpoint_cb = rfp_test_mode->checkpoint_cb;
 #endif
     sigfox_rfp_test_mode_b_ctx.flags.test_mode_req = 1;
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
@@ -315,126 +383,118 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_B_process_fn(void)
     MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
 #endif
     SIGFOX_EP_API_message_status_t message_status;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
     sfx_u16 tmp;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    // Run the test mode until completion.
+    while (sigfox_rfp_test_mode_b_ctx.progress_status.progress < 100) {
 #endif
-    if (sigfox_rfp_test_mode_b_ctx.flags.test_mode_req == 1) {
-        sigfox_rfp_test_mode_b_ctx.flags.test_mode_req = 0;
-#ifdef SIGFOX_EP_ERROR_CODES
-        status = _start_timer();
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-        status = _send_application_message();
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else
-        _start_timer();
-        _send_application_message();
-#endif
-
-    }
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    else {
-        if (sigfox_rfp_test_mode_b_ctx.flags.ep_api_message_cplt == 1) {
-            sigfox_rfp_test_mode_b_ctx.flags.ep_api_message_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
-                goto errors;
-            }
-            sigfox_rfp_test_mode_b_ctx.cnt_message++;
-            if (sigfox_rfp_test_mode_b_ctx.cnt_message < CNT_MESSAGE_LOOP) {
+        if (sigfox_rfp_test_mode_b_ctx.flags.test_mode_req == 1) {
+            sigfox_rfp_test_mode_b_ctx.flags.test_mode_req = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-                status = _send_application_message();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = _start_timer();
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = _send_application_message();
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-                _send_application_message();
+            _start_timer();
+            _send_application_message();
 #endif
-            }
         }
-        if ((sigfox_rfp_test_mode_b_ctx.flags.mcu_api_timer_cplt == 1) && (sigfox_rfp_test_mode_b_ctx.cnt_message >= CNT_MESSAGE_LOOP)) {
-            sigfox_rfp_test_mode_b_ctx.flags.mcu_api_timer_cplt = 0;
-            sigfox_rfp_test_mode_b_ctx.cnt_message = 0;
-#ifdef SIGFOX_EP_ERROR_CODES
-            mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-            MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
-#else
-            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-#endif
-            sigfox_rfp_test_mode_b_ctx.loop_iter++;
-            tmp = 100 * (sigfox_rfp_test_mode_b_ctx.loop_iter);
-            tmp /= LOOP;
-            sigfox_rfp_test_mode_b_ctx.progress_status.progress = (sfx_u8) tmp;
-            if (sigfox_rfp_test_mode_b_ctx.loop_iter < LOOP) {
-#ifdef SIGFOX_EP_ERROR_CODES
-                status = _start_timer();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-                status = _send_application_message();
-                if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
-                    MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+        else {
+            if (sigfox_rfp_test_mode_b_ctx.flags.ep_api_message_cplt == 1) {
+                sigfox_rfp_test_mode_b_ctx.flags.ep_api_message_cplt = 0;
+                message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+                SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+                SIGFOX_RFP_SOAK_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+                SIGFOX_RFP_THROUGHPUT_add_message_status(message_status);
+                if ((SOAK_ENABLE == SIGFOX_FALSE) && ((message_status.field.execution_error == 1) || ((message_status.field.network_error == 1) && (TX_CONTROL_ENABLE == SIGFOX_FALSE)))) {
                     goto errors;
                 }
 #else
-                _start_timer();
-                _send_application_message();
-#endif
-            } else {
-                if (sigfox_rfp_test_mode_b_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
-                    sigfox_rfp_test_mode_b_ctx.progress_status.progress = 100;
-                    sigfox_rfp_test_mode_b_ctx.test_mode.cplt_cb();
+                if ((SOAK_ENABLE == SIGFOX_FALSE) && (message_status.field.execution_error == 1 || message_status.field.network_error == 1)) {
+                    goto errors;
                 }
-            }
-        }
-    }
-#else
-    while (sigfox_rfp_test_mode_b_ctx.loop_iter < LOOP) {
-        if (sigfox_rfp_test_mode_b_ctx.flags.ep_api_message_cplt == 1) {
-            sigfox_rfp_test_mode_b_ctx.flags.ep_api_message_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
-                goto errors;
-            }
-            sigfox_rfp_test_mode_b_ctx.cnt_message++;
-            if (sigfox_rfp_test_mode_b_ctx.cnt_message < CNT_MESSAGE_LOOP) {
+#endif
+                sigfox_rfp_test_mode_b_ctx.cnt_message++;
+                if (sigfox_rfp_test_mode_b_ctx.cnt_message < CNT_MESSAGE_LOOP) {
 #ifdef SIGFOX_EP_ERROR_CODES
-                status = _send_application_message();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+                    status = _send_application_message();
+                    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-                _send_application_message();
+                    _send_application_message();
 #endif
-            } else {
+                } else {
+                    // Wait for the end of the window.
 #ifdef SIGFOX_EP_ERROR_CODES
-                mcu_api_status = MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-                MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+                    mcu_api_status = SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
+                    MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-                MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                    SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
 #endif
-                _MCU_API_timer_cplt_cb();
+                }
             }
-        }
-        if ((sigfox_rfp_test_mode_b_ctx.flags.mcu_api_timer_cplt == 1) && (sigfox_rfp_test_mode_b_ctx.cnt_message >= CNT_MESSAGE_LOOP)) {
-            sigfox_rfp_test_mode_b_ctx.flags.mcu_api_timer_cplt = 0;
-            sigfox_rfp_test_mode_b_ctx.cnt_message = 0;
+            if ((sigfox_rfp_test_mode_b_ctx.flags.mcu_api_timer_cplt == 1) && (sigfox_rfp_test_mode_b_ctx.cnt_message >= CNT_MESSAGE_LOOP)) {
+                sigfox_rfp_test_mode_b_ctx.flags.mcu_api_timer_cplt = 0;
+                sigfox_rfp_test_mode_b_ctx.cnt_message = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-            mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-            MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+                mcu_api_status = SIGFOX_RFP_COMMON_timer_stop();
+                MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                SIGFOX_RFP_COMMON_timer_stop();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+                SIGFOX_RFP_SOAK_end_window();
+#endif
+                sigfox_rfp_test_mode_b_ctx.loop_iter++;
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+                // Repeat the windows until the test mode is aborted.
+                if ((sigfox_rfp_test_mode_b_ctx.loop_iter >= LOOP) && (sigfox_rfp_test_mode_b_ctx.test_mode.soak == SIGFOX_TRUE)) {
+                    SIGFOX_RFP_SOAK_end_iteration();
+                    sigfox_rfp_test_mode_b_ctx.loop_iter = 0;
+                }
+#endif
+                tmp = 100 * (sigfox_rfp_test_mode_b_ctx.loop_iter);
+                tmp /= LOOP;
+                sigfox_rfp_test_mode_b_ctx.progress_status.progress = (sfx_u8) tmp;
+                if (sigfox_rfp_test_mode_b_ctx.loop_iter < LOOP) {
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+                    if (sigfox_rfp_test_mode_b_ctx.test_mode.checkpoint_cb != SIGFOX_NULL) {
+                        sigfox_rfp_test_mode_b_ctx.test_mode.checkpoint_cb(sigfox_rfp_test_mode_b_ctx.loop_iter, 0);
+                    }
 #endif
-            sigfox_rfp_test_mode_b_ctx.loop_iter++;
-            if (sigfox_rfp_test_mode_b_ctx.loop_iter < LOOP) {
 #ifdef SIGFOX_EP_ERROR_CODES
-                status = _start_timer();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-                status = _send_application_message();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+                    status = _start_timer();
+                    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+                    status = _send_application_message();
+                    if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
+                        SIGFOX_RFP_COMMON_timer_stop();
+                        goto errors;
+                    }
 #else
-                _start_timer();
-                _send_application_message();
+                    _start_timer();
+                    _send_application_message();
 #endif
+                } else {
+                    sigfox_rfp_test_mode_b_ctx.progress_status.progress = 100;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+                    if (sigfox_rfp_test_mode_b_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
+                        sigfox_rfp_test_mode_b_ctx.test_mode.cplt_cb();
+                    }
+#endif
+                }
             }
         }
+#ifndef SIGFOX_EP_ASYNCHRONOUS
     }
-    sigfox_rfp_test_mode_b_ctx.progress_status.progress = 100;
 #endif
-
     SIGFOX_RETURN();
 errors:
     sigfox_rfp_test_mode_b_ctx.progress_status.status.error = 1;
@@ -455,4 +515,29 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_B_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_b_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_B_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode B.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_B_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+    sfx_u32 message_ms = CNT_MESSAGE_LOOP * SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 1, 500);
+    // CNT_MESSAGE_LOOP messages per window.
+    plan->number_of_messages = LOOP * CNT_MESSAGE_LOOP;
+    plan->number_of_frames = LOOP * CNT_MESSAGE_LOOP;
+    plan->duration_ms = LOOP * ((message_ms > WINDOW_TIME_MS) ? message_ms : WINDOW_TIME_MS);
+    plan->open_ended = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    // The plan covers one pass of the windows.
+    if (rfp_test_mode->soak == SIGFOX_TRUE) {
+        plan->open_ended = SIGFOX_TRUE;
+    }
+#endif
+}
+#endif
 #endif
@@ -54,9 +54,16 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "manuf/mcu_api.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 #ifdef SIGFOX_EP_CERTIFICATION
 
 #ifdef SIGFOX_EP_SINGLE_FRAME
@@ -80,11 +87,17 @@ typedef struct {
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_C_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_C_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_C_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_C_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_C_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_C_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_C_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_C_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_C_plan_fn,
+#endif
 };
 
 static SIGFOX_RFP_TEST_MODE_C_context_t sigfox_rfp_test_mode_c_ctx = {
@@ -229,16 +242,16 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #endif
 #ifdef SIGFOX_EP_ERROR_CODES
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
@@ -309,115 +322,82 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_C_process_fn(void)
 #endif
     SIGFOX_EP_API_message_status_t message_status;
     MCU_API_timer_t timer;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
     sfx_u16 tmp;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    // Run the test mode until completion.
+    while (sigfox_rfp_test_mode_c_ctx.progress_status.progress < 100) {
 #endif
-    if (sigfox_rfp_test_mode_c_ctx.flags.test_mode_req == 1) {
-        sigfox_rfp_test_mode_c_ctx.flags.test_mode_req = 0;
+        if (sigfox_rfp_test_mode_c_ctx.flags.test_mode_req == 1) {
+            sigfox_rfp_test_mode_c_ctx.flags.test_mode_req = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-        status = _send_application_message();
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = _send_application_message();
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-        _send_application_message();
+            _send_application_message();
 #endif
-    }
+        }
+        else {
+            if (sigfox_rfp_test_mode_c_ctx.flags.ep_api_message_cplt == 1) {
+                sigfox_rfp_test_mode_c_ctx.flags.ep_api_message_cplt = 0;
+                message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+                SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
+                if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
+                    goto errors;
+                }
+                sigfox_rfp_test_mode_c_ctx.loop_iter++;
+                tmp = 100 * (sigfox_rfp_test_mode_c_ctx.loop_iter);
+                tmp /= LOOP;
+                sigfox_rfp_test_mode_c_ctx.progress_status.progress = (sfx_u8) tmp;
+                if (sigfox_rfp_test_mode_c_ctx.loop_iter < LOOP) {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
-    else {
-        if ((sigfox_rfp_test_mode_c_ctx.flags.ep_api_message_cplt == 1)) {
-            sigfox_rfp_test_mode_c_ctx.flags.ep_api_message_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
-                goto errors;
-            }
-            sigfox_rfp_test_mode_c_ctx.loop_iter++;
-            tmp = 100 * (sigfox_rfp_test_mode_c_ctx.loop_iter);
-            tmp /= LOOP;
-            sigfox_rfp_test_mode_c_ctx.progress_status.progress = (sfx_u8) tmp;
-            if (sigfox_rfp_test_mode_c_ctx.loop_iter < LOOP) {
-                timer.cplt_cb = &_MCU_API_timer_cplt_cb;
-                // Configure timer structure
-                timer.duration_ms = WINDOW_TIME_MS;
-                timer.instance = MCU_API_TIMER_INSTANCE_ADDON_RFP;
-                timer.reason = MCU_API_TIMER_REASON_ADDON_RFP;
-                // Start timer and send Application message
-#ifdef SIGFOX_EP_ERROR_CODES
-                mcu_api_status = MCU_API_timer_start(&timer);
-                MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
-#else
-                MCU_API_timer_start(&timer);
+                    timer.cplt_cb = &_MCU_API_timer_cplt_cb;
 #endif
-            } else {
-                if (sigfox_rfp_test_mode_c_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
-                    sigfox_rfp_test_mode_c_ctx.progress_status.progress = 100;
-                    sigfox_rfp_test_mode_c_ctx.test_mode.cplt_cb();
-                }
-            }
-        }
-        if (sigfox_rfp_test_mode_c_ctx.flags.mcu_api_timer_cplt == 1) {
-            sigfox_rfp_test_mode_c_ctx.flags.mcu_api_timer_cplt = 0;
+                    // Configure timer structure
+                    timer.duration_ms = WINDOW_TIME_MS;
+                    timer.instance = MCU_API_TIMER_INSTANCE_ADDON_RFP;
+                    timer.reason = MCU_API_TIMER_REASON_ADDON_RFP;
+                    // Start timer and wait for the inter-message delay.
 #ifdef SIGFOX_EP_ERROR_CODES
-            mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-            MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+                    mcu_api_status = SIGFOX_RFP_COMMON_timer_start(&timer);
+                    MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+                    mcu_api_status = SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
+                    MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                    SIGFOX_RFP_COMMON_timer_start(&timer);
+                    SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
 #endif
-
-#ifdef SIGFOX_EP_ERROR_CODES
-            status = _send_application_message();
-            if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
-                goto errors;
-            }
-#else
-            _send_application_message();
+                } else {
+                    sigfox_rfp_test_mode_c_ctx.progress_status.progress = 100;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+                    if (sigfox_rfp_test_mode_c_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
+                        sigfox_rfp_test_mode_c_ctx.test_mode.cplt_cb();
+                    }
 #endif
-        }
-    }
-#else
-    while (sigfox_rfp_test_mode_c_ctx.loop_iter < LOOP) {
-        if ((sigfox_rfp_test_mode_c_ctx.flags.ep_api_message_cplt == 1)) {
-            sigfox_rfp_test_mode_c_ctx.flags.ep_api_message_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
-                goto errors;
+                }
             }
-            sigfox_rfp_test_mode_c_ctx.loop_iter++;
-            if (sigfox_rfp_test_mode_c_ctx.loop_iter < LOOP) {
-                // Configure timer structure
-                timer.duration_ms = WINDOW_TIME_MS;
-                timer.instance = MCU_API_TIMER_INSTANCE_ADDON_RFP;
-                timer.reason = MCU_API_TIMER_REASON_ADDON_RFP;
-                // Start timer and send Application message
+            if (sigfox_rfp_test_mode_c_ctx.flags.mcu_api_timer_cplt == 1) {
+                sigfox_rfp_test_mode_c_ctx.flags.mcu_api_timer_cplt = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-                mcu_api_status = MCU_API_timer_start(&timer);
-                MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
-                mcu_api_status = MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                mcu_api_status = SIGFOX_RFP_COMMON_timer_stop();
                 MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-                MCU_API_timer_start(&timer);
-                MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-
-#endif
-                _MCU_API_timer_cplt_cb();
-            }
-        }
-        if (sigfox_rfp_test_mode_c_ctx.flags.mcu_api_timer_cplt == 1) {
-            sigfox_rfp_test_mode_c_ctx.flags.mcu_api_timer_cplt = 0;
-#ifdef SIGFOX_EP_ERROR_CODES
-            mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-            MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
-#else
-            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                SIGFOX_RFP_COMMON_timer_stop();
 #endif
-
 #ifdef SIGFOX_EP_ERROR_CODES
-            status = _send_application_message();
-            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+                status = _send_application_message();
+                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-            _send_application_message();
+                _send_application_message();
 #endif
+            }
         }
+#ifndef SIGFOX_EP_ASYNCHRONOUS
     }
-    sigfox_rfp_test_mode_c_ctx.progress_status.progress = 100;
 #endif
     SIGFOX_RETURN();
 errors:
@@ -439,4 +419,23 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_C_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_c_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_C_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode C.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_C_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+    sfx_u32 message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES), 1, 10);
+    // Messages are separated by the window timer.
+    plan->number_of_messages = LOOP;
+    plan->number_of_frames = LOOP;
+    plan->duration_ms = (LOOP * message_ms) + ((LOOP - 1) * WINDOW_TIME_MS);
+    plan->open_ended = SIGFOX_FALSE;
+}
+#endif
 #endif // SIGFOX_EP_CERTIFICATION
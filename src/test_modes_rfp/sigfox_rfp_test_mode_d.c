@@ -38,9 +38,16 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
 #include "manuf/mcu_api.h"
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 
 #if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_BIDIRECTIONAL)
 
@@ -52,6 +59,9 @@ typedef struct {
         sfx_u8 test_mode_req          : 1;
     }flags;
     SIGFOX_RFP_test_mode_t test_mode;
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    sfx_u8 frequency_idx;
+#endif
     SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
 } SIGFOX_RFP_TEST_MODE_D_context_t;
 
@@ -60,11 +70,17 @@ static const sfx_u8 dl_pattern[SIGFOX_DL_PAYLOAD_SIZE_BYTES] = {0x32, 0x68, 0xc5
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_D_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_D_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_D_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_D_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_D_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_D_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_D_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_D_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_D_plan_fn,
+#endif
 };
 
 static SIGFOX_RFP_TEST_MODE_D_context_t sigfox_rfp_test_mode_d_ctx = {
@@ -83,6 +99,10 @@ static SIGFOX_RFP_TEST_MODE_D_context_t sigfox_rfp_test_mode_d_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .test_mode.process_cb           = SIGFOX_NULL,
     .test_mode.cplt_cb              = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    .test_mode.rx_scan              = SIGFOX_NULL,
+    .frequency_idx                  = 0,
 #endif
     .progress_status.status.error   = 0,
     .progress_status.progress       = 0,
@@ -105,6 +125,77 @@ static void _SIGFOX_EP_API_message_cplt_cb(void) {
 #endif
 }
 
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t *_get_rx_scan_stats(void)
+ * \brief Get the statistics of the frequency currently listened to.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Statistics entry, NULL when the test mode is not scanning.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t *_get_rx_scan_stats(void) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_RFP_API_rx_scan_t *rx_scan = sigfox_rfp_test_mode_d_ctx.test_mode.rx_scan;
+    if ((rx_scan == SIGFOX_NULL) || (sigfox_rfp_test_mode_d_ctx.frequency_idx >= rx_scan->number_of_frequencies)) {
+        return SIGFOX_NULL;
+    }
+    return &((rx_scan->stats_table)[sigfox_rfp_test_mode_d_ctx.frequency_idx]);
+}
+#endif
+
+/*!******************************************************************
+ * \fn static void _end_rx_frequency(void)
+ * \brief Stop listening to the current frequency, the test mode ends after the last one.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _end_rx_frequency(void) {
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    // Local variables.
+    const SIGFOX_EP_ADDON_RFP_API_rx_scan_t *rx_scan = sigfox_rfp_test_mode_d_ctx.test_mode.rx_scan;
+    if ((rx_scan != SIGFOX_NULL) && (rx_scan->number_of_frequencies != 0)) {
+        sigfox_rfp_test_mode_d_ctx.frequency_idx++;
+        sigfox_rfp_test_mode_d_ctx.progress_status.progress = (sfx_u8) ((100 * (sfx_u16) sigfox_rfp_test_mode_d_ctx.frequency_idx) / (rx_scan->number_of_frequencies));
+        return;
+    }
+#endif
+    sigfox_rfp_test_mode_d_ctx.progress_status.progress = 100;
+}
+
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+/*!******************************************************************
+ * \fn static void _add_rx_scan_frame(sfx_s16 dl_rssi_dbm, sfx_bool dl_check)
+ * \brief Account a downlink frame received on the current frequency.
+ * \param[in]   dl_rssi_dbm: RSSI of the received frame.
+ * \param[in]   dl_check: SIGFOX_TRUE if the frame matches the test pattern.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _add_rx_scan_frame(sfx_s16 dl_rssi_dbm, sfx_bool dl_check) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t *rx_scan_stats = _get_rx_scan_stats();
+    if ((rx_scan_stats == SIGFOX_NULL) || (rx_scan_stats->number_of_frames == 0xFFFF)) {
+        return;
+    }
+    if ((rx_scan_stats->number_of_frames == 0) || (dl_rssi_dbm < rx_scan_stats->rssi_min_dbm)) {
+        rx_scan_stats->rssi_min_dbm = dl_rssi_dbm;
+    }
+    if ((rx_scan_stats->number_of_frames == 0) || (dl_rssi_dbm > rx_scan_stats->rssi_max_dbm)) {
+        rx_scan_stats->rssi_max_dbm = dl_rssi_dbm;
+    }
+    rx_scan_stats->rssi_sum_dbm += dl_rssi_dbm;
+    rx_scan_stats->number_of_frames++;
+    if (dl_check == SIGFOX_TRUE) {
+        rx_scan_stats->number_of_matches++;
+    }
+    // Move to the next frequency once the requested number of frames is reached.
+    if (((sigfox_rfp_test_mode_d_ctx.test_mode.rx_scan)->number_of_frames != 0) && (rx_scan_stats->number_of_frames >= (sigfox_rfp_test_mode_d_ctx.test_mode.rx_scan)->number_of_frames)) {
+        _end_rx_frequency();
+    }
+}
+#endif
+
 /*!******************************************************************
  * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void)
  * \brief Send application message
@@ -119,6 +210,9 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #endif
     SIGFOX_EP_API_TEST_parameters_t test_param = {0};
     SIGFOX_EP_API_application_message_t application_message = {0};
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t *rx_scan_stats = _get_rx_scan_stats();
+#endif
 #ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
 #if (SIGFOX_EP_UL_PAYLOAD_SIZE != 0)
     sfx_u8 data_cnt;
@@ -179,6 +273,14 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
     test_param.tx_frequency_hz = 0;
     test_param.rx_frequency_hz = sigfox_rfp_test_mode_d_ctx.test_mode.rc->f_dl_hz;
     test_param.dl_t_rx_ms = TIMEOUT_MS;
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    if (rx_scan_stats != SIGFOX_NULL) {
+        test_param.rx_frequency_hz = rx_scan_stats->rx_frequency_hz;
+        if ((sigfox_rfp_test_mode_d_ctx.test_mode.rx_scan)->dwell_time_ms != 0) {
+            test_param.dl_t_rx_ms = (sigfox_rfp_test_mode_d_ctx.test_mode.rx_scan)->dwell_time_ms;
+        }
+    }
+#endif
     test_param.dl_t_w_ms = 0;
     test_param.flags.field.ul_enable = 0;
     test_param.flags.field.dl_enable = 1;
@@ -195,10 +297,10 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #endif
     // Send Application message
 #ifdef SIGFOX_EP_ERROR_CODES
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-    SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
     _SIGFOX_EP_API_message_cplt_cb();
@@ -220,6 +322,10 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_D_init_fn(SIGFOX_RF
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    SIGFOX_EP_ADDON_RFP_API_rx_scan_stats_t *rx_scan_stats = SIGFOX_NULL;
+    sfx_u8 idx = 0;
+#endif
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
     if (rfp_test_mode == SIGFOX_NULL) {
 #ifdef SIGFOX_EP_ERROR_CODES
@@ -247,6 +353,24 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_D_init_fn(SIGFOX_RF
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     sigfox_rfp_test_mode_d_ctx.test_mode.process_cb = rfp_test_mode->process_cb;
     sigfox_rfp_test_mode_d_ctx.test_mode.cplt_cb = rfp_test_mode->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    sigfox_rfp_test_mode_d_ctx.test_mode.rx_scan = rfp_test_mode->rx_scan;
+    sigfox_rfp_test_mode_d_ctx.frequency_idx = 0;
+    if (rfp_test_mode->rx_scan != SIGFOX_NULL) {
+        for (idx = 0; idx < (rfp_test_mode->rx_scan)->number_of_frequencies; idx++) {
+            rx_scan_stats = &(((rfp_test_mode->rx_scan)->stats_table)[idx]);
+            rx_scan_stats->rx_frequency_hz = ((rfp_test_mode->rx_scan)->frequency_list_hz)[idx];
+            if (rx_scan_stats->rx_frequency_hz == 0) {
+                rx_scan_stats->rx_frequency_hz = (rfp_test_mode->rc)->f_dl_hz;
+            }
+            rx_scan_stats->number_of_frames = 0;
+            rx_scan_stats->number_of_matches = 0;
+            rx_scan_stats->rssi_min_dbm = 0;
+            rx_scan_stats->rssi_max_dbm = 0;
+            rx_scan_stats->rssi_sum_dbm = 0;
+        }
+    }
 #endif
     sigfox_rfp_test_mode_d_ctx.flags.test_mode_req = 1;
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
@@ -271,42 +395,44 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_D_process_fn(void)
     sfx_bool dl_check;
     sfx_u8 payload_cnt, dl_payload[SIGFOX_DL_PAYLOAD_SIZE_BYTES];
     sfx_s16 dl_rssi_dbm;
-
-    if (sigfox_rfp_test_mode_d_ctx.flags.test_mode_req == 1) {
-        sigfox_rfp_test_mode_d_ctx.flags.test_mode_req = 0;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    // Run the test mode until completion.
+    while (sigfox_rfp_test_mode_d_ctx.progress_status.progress < 100) {
+#endif
+        if (sigfox_rfp_test_mode_d_ctx.flags.test_mode_req == 1) {
+            sigfox_rfp_test_mode_d_ctx.flags.test_mode_req = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-        status = _send_application_message();
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = _send_application_message();
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-        _send_application_message();
-#endif
-    }
-#ifndef SIGFOX_EP_ASYNCHRONOUS
-    while (1) {
+            _send_application_message();
 #endif
-        if (sigfox_rfp_test_mode_d_ctx.flags.ep_api_message_cplt == 1) {
+        }
+        else if (sigfox_rfp_test_mode_d_ctx.flags.ep_api_message_cplt == 1) {
             sigfox_rfp_test_mode_d_ctx.flags.ep_api_message_cplt = 0;
             message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+            SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+            SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
             if (message_status.field.execution_error == 1) {
                 goto errors;
             }
             if (message_status.field.network_error == 1) {
-#ifndef SIGFOX_EP_ASYNCHRONOUS
-                sigfox_rfp_test_mode_d_ctx.progress_status.progress = 100;
-                break;
-#else
-            if (sigfox_rfp_test_mode_d_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
-                sigfox_rfp_test_mode_d_ctx.progress_status.progress = 100;
-                sigfox_rfp_test_mode_d_ctx.test_mode.cplt_cb();
-            }
-#endif
+                // No downlink frame received before timeout.
+                _end_rx_frequency();
             }
             if (message_status.field.dl_frame == 1) {
 #ifdef SIGFOX_EP_ERROR_CODES
                 sigfox_ep_api_status = SIGFOX_EP_API_get_dl_payload(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
                 SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-            SIGFOX_EP_API_get_dl_payload(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
+                SIGFOX_EP_API_get_dl_payload(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                SIGFOX_RFP_STREAM_add_downlink(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, dl_rssi_dbm);
 #endif
                 dl_check = SIGFOX_TRUE;
                 for (payload_cnt = 0; payload_cnt < SIGFOX_DL_PAYLOAD_SIZE_BYTES; payload_cnt++) {
@@ -314,15 +440,27 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_D_process_fn(void)
                         dl_check = SIGFOX_FALSE;
                     }
                 }
-
                 if ((dl_check == SIGFOX_TRUE) && (sigfox_rfp_test_mode_d_ctx.test_mode.downlink_cplt_cb != SIGFOX_NULL)) {
                     sigfox_rfp_test_mode_d_ctx.test_mode.downlink_cplt_cb(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, dl_rssi_dbm);
                 }
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+                _add_rx_scan_frame(dl_rssi_dbm, dl_check);
+#endif
+            }
+            if (sigfox_rfp_test_mode_d_ctx.progress_status.progress >= 100) {
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+                if (sigfox_rfp_test_mode_d_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
+                    sigfox_rfp_test_mode_d_ctx.test_mode.cplt_cb();
+                }
+#endif
+            }
+            else if ((message_status.field.network_error == 1) || (message_status.field.dl_frame == 1)) {
+                // Listen again, on the next frequency of the scanning plan if the current one is done.
 #ifdef SIGFOX_EP_ERROR_CODES
                 status = _send_application_message();
                 SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-            _send_application_message();
+                _send_application_message();
 #endif
             }
         }
@@ -349,4 +487,30 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_D_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_d_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_D_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode D.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_D_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Single listening window, restarted each time a downlink frame is received.
+    plan->number_of_messages = 1;
+    plan->number_of_frames = 0;
+    plan->duration_ms = TIMEOUT_MS;
+    plan->open_ended = SIGFOX_TRUE;
+#ifdef SIGFOX_EP_ADDON_RFP_RX_SCAN
+    // One listening window per scanned frequency at least.
+    if (rfp_test_mode->rx_scan != SIGFOX_NULL) {
+        plan->number_of_messages = (rfp_test_mode->rx_scan)->number_of_frequencies;
+        plan->duration_ms = (((rfp_test_mode->rx_scan)->dwell_time_ms != 0) ? (rfp_test_mode->rx_scan)->dwell_time_ms : TIMEOUT_MS) * (plan->number_of_messages);
+    }
+#else
+    (void) rfp_test_mode;
+#endif
+}
+#endif
 #endif // SIGFOX_EP_CERTIFICATION
@@ -50,15 +50,30 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "manuf/mcu_api.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 
 #if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_BIDIRECTIONAL)
 
 #define LOOP 301
 #define LISTENIG_WINDOW_TIMER_MS 4000
 #define WAITING_TIMER_MS 6000
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+// Half width of the indifference region around the threshold, in percent.
+#define EARLY_STOP_INDIFFERENCE_PERCENT 5
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+// Shortest waiting time between the uplink and the listening window (0 selects the default Sigfox waiting time).
+#define SINGLE_PASS_DL_T_W_MS 1
+#endif
 
 typedef enum {
     MODE_E_STATE_WAIT,
@@ -80,6 +95,11 @@ typedef struct {
 #if (defined SIGFOX_EP_UL_PAYLOAD_SIZE) && (SIGFOX_EP_UL_PAYLOAD_SIZE != 0)
     sfx_u16 tx_cnt;
     sfx_u16 rx_cnt;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    sfx_u32 send_ms;
+    sfx_u32 message_end_ms;
+    sfx_u32 programmed_ms;
 #endif
     SIGFOX_RFP_test_mode_t test_mode;
     SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
@@ -88,13 +108,36 @@ typedef struct {
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_E_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_E_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_E_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_E_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_E_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_E_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_E_plan_fn,
+#endif
 };
 
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+// Natural logarithm of 1 to 99, multiplied by 1000.
+static const sfx_u16 SIGFOX_RFP_TEST_MODE_E_LN_X1000[99] = {
+    0, 693, 1099, 1386, 1609, 1792, 1946, 2079, 2197, 2303, 2398,
+    2485, 2565, 2639, 2708, 2773, 2833, 2890, 2944, 2996, 3045, 3091,
+    3135, 3178, 3219, 3258, 3296, 3332, 3367, 3401, 3434, 3466, 3497,
+    3526, 3555, 3584, 3611, 3638, 3664, 3689, 3714, 3738, 3761, 3784,
+    3807, 3829, 3850, 3871, 3892, 3912, 3932, 3951, 3970, 3989, 4007,
+    4025, 4043, 4060, 4078, 4094, 4111, 4127, 4143, 4159, 4174, 4190,
+    4205, 4220, 4234, 4248, 4263, 4277, 4290, 4304, 4317, 4331, 4344,
+    4357, 4369, 4382, 4394, 4407, 4419, 4431, 4443, 4454, 4466, 4477,
+    4489, 4500, 4511, 4522, 4533, 4543, 4554, 4564, 4575, 4585, 4595
+};
+// SPRT decision boundary ln((1 - beta) / alpha) of each confidence level with alpha = beta = 1 - confidence, multiplied by 1000.
+static const sfx_u16 SIGFOX_RFP_TEST_MODE_E_SPRT_BOUND_X1000[SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_LAST] = { 2197, 2944, 4595 };
+#endif
+
 static SIGFOX_RFP_TEST_MODE_E_context_t sigfox_rfp_test_mode_e_ctx = {
     .flags.ep_api_message_cplt      = 0,
     .flags.mcu_api_timer_cplt       = 0,
@@ -111,6 +154,22 @@ static SIGFOX_RFP_TEST_MODE_E_context_t sigfox_rfp_test_mode_e_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .test_mode.process_cb           = SIGFOX_NULL,
     .test_mode.cplt_cb              = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    .test_mode.checkpoint_cb        = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    .test_mode.early_stop_threshold_percent = 0,
+    .test_mode.early_stop_confidence = SIGFOX_EP_ADDON_RFP_API_CONFIDENCE_95,
+    .test_mode.early_stop_report    = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    .send_ms                        = 0,
+    .message_end_ms                 = 0,
+    .programmed_ms                  = 0,
+    .test_mode.get_time_ms          = SIGFOX_NULL,
+    .test_mode.single_pass          = SIGFOX_FALSE,
+    .test_mode.single_pass_report   = SIGFOX_NULL,
 #endif
     .progress_status.status.error   = 0,
     .progress_status.progress       = 0,
@@ -124,7 +183,11 @@ static SIGFOX_RFP_TEST_MODE_E_context_t sigfox_rfp_test_mode_e_ctx = {
  * \retval      none
  *******************************************************************/
 static void _SIGFOX_EP_API_message_cplt_cb(void) {
-
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    if (sigfox_rfp_test_mode_e_ctx.test_mode.get_time_ms != SIGFOX_NULL) {
+        sigfox_rfp_test_mode_e_ctx.message_end_ms = sigfox_rfp_test_mode_e_ctx.test_mode.get_time_ms();
+    }
+#endif
     sigfox_rfp_test_mode_e_ctx.flags.ep_api_message_cplt = 1;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     if (sigfox_rfp_test_mode_e_ctx.test_mode.process_cb != SIGFOX_NULL) {
@@ -146,8 +209,6 @@ static void _MCU_API_timer_cplt_cb(void) {
     if (sigfox_rfp_test_mode_e_ctx.test_mode.process_cb != SIGFOX_NULL) {
         sigfox_rfp_test_mode_e_ctx.test_mode.process_cb();
     }
-#else
-    MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
 #endif
 }
 
@@ -172,6 +233,92 @@ static void _populate_common_param(SIGFOX_EP_API_common_t *common_param) {
 }
 #endif
 
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+/*!******************************************************************
+ * \fn static void _update_early_stop(void)
+ * \brief Count the last listening window and decide if the downlink success ratio is above or below the threshold.
+ * \brief The decision is a Wald sequential probability ratio test of p1 = t + d against p0 = t - d, with d the indifference half width.
+ * \brief After k received frames out of n windows, the log-likelihood ratio k * ln(p1 / p0) - (n - k) * ln((1 - p0) / (1 - p1))
+ * \brief is compared to +/- ln((1 - beta) / alpha), so that both error rates stay below 1 - confidence whatever the number of windows.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _update_early_stop(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_early_stop_report_t *report = sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_report;
+    sfx_s32 threshold = (sfx_s32) sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_threshold_percent;
+    sfx_s32 p0 = threshold - EARLY_STOP_INDIFFERENCE_PERCENT;
+    sfx_s32 p1 = threshold + EARLY_STOP_INDIFFERENCE_PERCENT;
+    sfx_s32 llr_x1000;
+    sfx_s32 bound_x1000;
+    if (report == SIGFOX_NULL) {
+        return;
+    }
+    report->number_of_windows++;
+    if (sigfox_rfp_test_mode_e_ctx.flags.received == 1) {
+        report->number_of_received++;
+    }
+    if (threshold == 0) {
+        return;
+    }
+    // Keep both hypotheses inside ]0;100[ for the logarithms.
+    if (p0 < 1) {
+        p0 = 1;
+    }
+    if (p1 > 99) {
+        p1 = 99;
+    }
+    llr_x1000 = ((sfx_s32) report->number_of_received) * ((sfx_s32) SIGFOX_RFP_TEST_MODE_E_LN_X1000[p1 - 1] - (sfx_s32) SIGFOX_RFP_TEST_MODE_E_LN_X1000[p0 - 1]);
+    llr_x1000 -= ((sfx_s32) (report->number_of_windows - report->number_of_received)) * ((sfx_s32) SIGFOX_RFP_TEST_MODE_E_LN_X1000[99 - p0] - (sfx_s32) SIGFOX_RFP_TEST_MODE_E_LN_X1000[99 - p1]);
+    bound_x1000 = (sfx_s32) SIGFOX_RFP_TEST_MODE_E_SPRT_BOUND_X1000[sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_confidence];
+    if (llr_x1000 >= bound_x1000) {
+        report->verdict = SIGFOX_EP_ADDON_RFP_API_VERDICT_PASS;
+    }
+    else if (llr_x1000 <= (-bound_x1000)) {
+        report->verdict = SIGFOX_EP_ADDON_RFP_API_VERDICT_FAIL;
+    }
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+/*!******************************************************************
+ * \fn static sfx_u32 _get_time_ms(void)
+ * \brief Read the time source, 0 when it is not set.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current time in milliseconds.
+ *******************************************************************/
+static sfx_u32 _get_time_ms(void) {
+    return (sigfox_rfp_test_mode_e_ctx.test_mode.get_time_ms != SIGFOX_NULL) ? sigfox_rfp_test_mode_e_ctx.test_mode.get_time_ms() : 0;
+}
+
+/*!******************************************************************
+ * \fn static void _add_gap(sfx_s32 gap_ms)
+ * \brief Add a measured gap to the single pass report.
+ * \param[in]   gap_ms: Measured gap in milliseconds.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _add_gap(sfx_s32 gap_ms) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_single_pass_report_t *report = sigfox_rfp_test_mode_e_ctx.test_mode.single_pass_report;
+    if ((report == SIGFOX_NULL) || (sigfox_rfp_test_mode_e_ctx.test_mode.get_time_ms == SIGFOX_NULL)) {
+        return;
+    }
+    if ((report->number_of_gaps == 0) || (gap_ms < report->gap_min_ms)) {
+        report->gap_min_ms = gap_ms;
+    }
+    if ((report->number_of_gaps == 0) || (gap_ms > report->gap_max_ms)) {
+        report->gap_max_ms = gap_ms;
+    }
+    report->last_gap_ms = gap_ms;
+    if (report->number_of_gaps < 0xFFFF) {
+        report->number_of_gaps++;
+    }
+}
+#endif
+
 /*!******************************************************************
  * \fn static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_start_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode)
  * \brief Start Test Mode C.
@@ -206,11 +353,43 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_init_fn(SIGFOX_RF
     sigfox_rfp_test_mode_e_ctx.test_mode.ul_bit_rate = rfp_test_mode->ul_bit_rate;
 #endif
 #ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
-    sigfox_rfp_test_mode_e_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp,
+    sigfox_rfp_test_mode_e_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp;
 #endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     sigfox_rfp_test_mode_e_ctx.test_mode.process_cb = rfp_test_mode->process_cb;
     sigfox_rfp_test_mode_e_ctx.test_mode.cplt_cb = rfp_test_mode->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    // Resume after the last completed iteration, the next uplink reports its downlink reception.
+    if ((rfp_test_mode->start_step != 0) && (rfp_test_mode->start_step < LOOP)) {
+        sigfox_rfp_test_mode_e_ctx.index = rfp_test_mode->start_step;
+        sigfox_rfp_test_mode_e_ctx.flags.received = (rfp_test_mode->start_state != 0) ? 1 : 0;
+        sigfox_rfp_test_mode_e_ctx.progress_status.progress = (sfx_u8) ((100 * rfp_test_mode->start_step) / LOOP);
+    }
+    sigfox_rfp_test_mode_e_ctx.test_mode.checkpoint_cb = rfp_test_mode->checkpoint_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+    // The counts start from the resume point when the test mode is resumed.
+    sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_threshold_percent = rfp_test_mode->early_stop_threshold_percent;
+    sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_confidence = rfp_test_mode->early_stop_confidence;
+    sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_report = rfp_test_mode->early_stop_report;
+    if (rfp_test_mode->early_stop_report != SIGFOX_NULL) {
+        rfp_test_mode->early_stop_report->verdict = SIGFOX_EP_ADDON_RFP_API_VERDICT_PENDING;
+        rfp_test_mode->early_stop_report->number_of_windows = 0;
+        rfp_test_mode->early_stop_report->number_of_received = 0;
+    }
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    sigfox_rfp_test_mode_e_ctx.test_mode.get_time_ms = rfp_test_mode->get_time_ms;
+    sigfox_rfp_test_mode_e_ctx.test_mode.single_pass = rfp_test_mode->single_pass;
+    sigfox_rfp_test_mode_e_ctx.test_mode.single_pass_report = rfp_test_mode->single_pass_report;
+    if (rfp_test_mode->single_pass_report != SIGFOX_NULL) {
+        rfp_test_mode->single_pass_report->single_pass = rfp_test_mode->single_pass;
+        rfp_test_mode->single_pass_report->number_of_gaps = 0;
+        rfp_test_mode->single_pass_report->gap_min_ms = 0;
+        rfp_test_mode->single_pass_report->gap_max_ms = 0;
+        rfp_test_mode->single_pass_report->last_gap_ms = 0;
+    }
 #endif
     sigfox_rfp_test_mode_e_ctx.test_state = MODE_E_STATE_BIDIR_UP_ONLY;
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
@@ -237,6 +416,9 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
     SIGFOX_EP_API_message_status_t message_status;
     MCU_API_timer_t timer;
     sfx_u16 tmp;
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    SIGFOX_RFP_COMMON_airtime_t airtime;
+#endif
 #if (defined SIGFOX_EP_UL_PAYLOAD_SIZE) && (SIGFOX_EP_UL_PAYLOAD_SIZE != 0)
     sfx_u8 data_cnt, data[SIGFOX_EP_UL_PAYLOAD_SIZE];
     for (data_cnt = 0; data_cnt < SIGFOX_EP_UL_PAYLOAD_SIZE; data_cnt++) {
@@ -279,10 +461,10 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
                 if (sigfox_rfp_test_mode_e_ctx.flags.mcu_api_timer_cplt == 1) {
                     sigfox_rfp_test_mode_e_ctx.flags.mcu_api_timer_cplt = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-                    mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                    mcu_api_status = SIGFOX_RFP_COMMON_timer_stop();
                     MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-                MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                SIGFOX_RFP_COMMON_timer_stop();
 #endif
                 }
                 if (sigfox_rfp_test_mode_e_ctx.flags.test_mode_req == 1) {
@@ -319,16 +501,33 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
 #ifndef SIGFOX_EP_T_CONF_MS
                 message_param.t_conf_ms = 1400;
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+                // Open the listening window from the same call, right after the uplink.
+                if (sigfox_rfp_test_mode_e_ctx.test_mode.single_pass == SIGFOX_TRUE) {
+                    test_param.dl_t_w_ms = SINGLE_PASS_DL_T_W_MS;
+                    test_param.dl_t_rx_ms = LISTENIG_WINDOW_TIMER_MS;
+                    test_param.flags.field.dl_enable = 1;
+                    test_param.flags.field.dl_decoding_enable = 1;
+                    SIGFOX_RFP_COMMON_get_application_message_airtime(&message_param, &test_param, &airtime);
+                    sigfox_rfp_test_mode_e_ctx.programmed_ms = airtime.tx_ms + airtime.ifu_ms + airtime.t_w_ms + airtime.rx_ms;
+                    sigfox_rfp_test_mode_e_ctx.send_ms = _get_time_ms();
+                }
+#endif
 #ifdef SIGFOX_EP_ERROR_CODES
-                sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+                sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
                 SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-            SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+            SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
                 _SIGFOX_EP_API_message_cplt_cb();
 #endif
                 sigfox_rfp_test_mode_e_ctx.test_state = MODE_E_STATE_BIDIR_DLK_ONLY;
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+                if (sigfox_rfp_test_mode_e_ctx.test_mode.single_pass == SIGFOX_TRUE) {
+                    sigfox_rfp_test_mode_e_ctx.test_state = MODE_E_STATE_TIMER;
+                }
+#endif
             } else {
 #if (defined SIGFOX_EP_UL_PAYLOAD_SIZE) && (SIGFOX_EP_UL_PAYLOAD_SIZE != 0)
                 message_param.type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY;
@@ -343,6 +542,12 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
             if (sigfox_rfp_test_mode_e_ctx.flags.ep_api_message_cplt == 1) {
                 sigfox_rfp_test_mode_e_ctx.flags.ep_api_message_cplt = 0;
                 message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+                SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
                 if (message_status.field.execution_error == 1) {
                     goto errors;
                 }
@@ -385,11 +590,15 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
 #ifndef SIGFOX_EP_T_CONF_MS
                 message_param.t_conf_ms = 1400;
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+                // Time between the uplink completion and the listening call.
+                _add_gap((sfx_s32) (_get_time_ms() - sigfox_rfp_test_mode_e_ctx.message_end_ms));
+#endif
 #ifdef SIGFOX_EP_ERROR_CODES
-                sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+                sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
                 SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-            SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+            SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
                 _SIGFOX_EP_API_message_cplt_cb();
@@ -402,6 +611,12 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
             if (sigfox_rfp_test_mode_e_ctx.flags.ep_api_message_cplt == 1) {
                 sigfox_rfp_test_mode_e_ctx.flags.ep_api_message_cplt = 0;
                 message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+                SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
                 if (message_status.field.execution_error == 1) {
                     goto errors;
                 }
@@ -410,6 +625,20 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
                 } else {
                     sigfox_rfp_test_mode_e_ctx.flags.received = 0;
                 }
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+                // The listening window closes early when a frame is received, only full windows are measured.
+                if ((sigfox_rfp_test_mode_e_ctx.test_mode.single_pass == SIGFOX_TRUE) && (message_status.field.dl_frame == 0)) {
+                    _add_gap((sfx_s32) (sigfox_rfp_test_mode_e_ctx.message_end_ms - sigfox_rfp_test_mode_e_ctx.send_ms - sigfox_rfp_test_mode_e_ctx.programmed_ms));
+                }
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+                _update_early_stop();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+                if ((sigfox_rfp_test_mode_e_ctx.index < LOOP) && (sigfox_rfp_test_mode_e_ctx.test_mode.checkpoint_cb != SIGFOX_NULL)) {
+                    sigfox_rfp_test_mode_e_ctx.test_mode.checkpoint_cb(sigfox_rfp_test_mode_e_ctx.index, sigfox_rfp_test_mode_e_ctx.flags.received);
+                }
+#endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
 
                 timer.cplt_cb = &_MCU_API_timer_cplt_cb;
@@ -420,17 +649,28 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
                 timer.instance = MCU_API_TIMER_INSTANCE_ADDON_RFP;
                 // Start timer and send Application message
 #ifdef SIGFOX_EP_ERROR_CODES
-                mcu_api_status = MCU_API_timer_start(&timer);
+                mcu_api_status = SIGFOX_RFP_COMMON_timer_start(&timer);
+                MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+                mcu_api_status = SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
                 MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-            MCU_API_timer_start(&timer);
-#endif
-#ifndef SIGFOX_EP_ASYNCHRONOUS
-                _MCU_API_timer_cplt_cb();
+            SIGFOX_RFP_COMMON_timer_start(&timer);
+            SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_EARLY_STOP
+                if ((sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_report != SIGFOX_NULL) && (sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_report->verdict != SIGFOX_EP_ADDON_RFP_API_VERDICT_PENDING)) {
+                    sigfox_rfp_test_mode_e_ctx.test_state = MODE_E_STATE_END;
+                } else if (sigfox_rfp_test_mode_e_ctx.index >= LOOP) {
+                    if (sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_report != SIGFOX_NULL) {
+                        sigfox_rfp_test_mode_e_ctx.test_mode.early_stop_report->verdict = SIGFOX_EP_ADDON_RFP_API_VERDICT_UNDECIDED;
+                    }
+                    sigfox_rfp_test_mode_e_ctx.test_state = MODE_E_STATE_END;
+                } else {
+#else
                 if (sigfox_rfp_test_mode_e_ctx.index >= LOOP) {
                     sigfox_rfp_test_mode_e_ctx.test_state = MODE_E_STATE_END;
                 } else {
+#endif
                     sigfox_rfp_test_mode_e_ctx.test_state = MODE_E_STATE_BIDIR_UP_ONLY;
                 }
             }
@@ -440,10 +680,10 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_E_process_fn(void)
             if (sigfox_rfp_test_mode_e_ctx.flags.mcu_api_timer_cplt == 1) {
                 sigfox_rfp_test_mode_e_ctx.flags.mcu_api_timer_cplt = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-                mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                mcu_api_status = SIGFOX_RFP_COMMON_timer_stop();
                 MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+            SIGFOX_RFP_COMMON_timer_stop();
 #endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
                 if (sigfox_rfp_test_mode_e_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
@@ -480,4 +720,30 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_E_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_e_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_E_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode E.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_E_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+    sfx_u32 message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 1, 500);
+    // Each iteration is an uplink, a listening window and a waiting timer.
+    plan->number_of_messages = 2 * LOOP;
+    plan->number_of_frames = LOOP;
+    plan->duration_ms = LOOP * (message_ms + LISTENIG_WINDOW_TIMER_MS + WAITING_TIMER_MS);
+#ifdef SIGFOX_EP_ADDON_RFP_SINGLE_PASS
+    // The uplink and the listening window are sent as one message.
+    if (rfp_test_mode->single_pass == SIGFOX_TRUE) {
+        plan->number_of_messages = LOOP;
+        plan->duration_ms += LOOP * SINGLE_PASS_DL_T_W_MS;
+    }
+#endif
+    plan->open_ended = SIGFOX_FALSE;
+}
+#endif
 #endif // SIGFOX_EP_CERTIFICATION
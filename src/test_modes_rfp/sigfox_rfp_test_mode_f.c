@@ -47,8 +47,15 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 #if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_BIDIRECTIONAL)
 
 typedef enum {
@@ -70,11 +77,17 @@ typedef struct {
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_F_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_F_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_F_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_F_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_F_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_F_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_F_plan_fn,
+#endif
 };
 
 static SIGFOX_RFP_TEST_MODE_F_context_t sigfox_rfp_test_mode_f_ctx = {
@@ -247,10 +260,10 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_process_fn(void)
             message_param.t_conf_ms = 2000;
 #endif
 #ifdef SIGFOX_EP_ERROR_CODES
-            sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+            sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
             SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-        SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+        SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
 #endif
             sigfox_rfp_test_mode_f_ctx.test_state = MODE_F_STATE_CHECKUP_MESSAGE;
 #ifndef SIGFOX_EP_ASYNCHRONOUS
@@ -262,6 +275,12 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_process_fn(void)
                 sigfox_rfp_test_mode_f_ctx.flags.ep_api_message_cplt = 0;
                 sigfox_rfp_test_mode_f_ctx.progress_status.progress = 50;
                 message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+                SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
                 if (message_status.field.execution_error == 1) {
                     goto errors;
                 }
@@ -271,6 +290,9 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_process_fn(void)
                     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
                 SIGFOX_EP_API_get_dl_payload(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, &dl_rssi_dbm);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                    SIGFOX_RFP_STREAM_add_downlink(dl_payload, SIGFOX_DL_PAYLOAD_SIZE_BYTES, dl_rssi_dbm);
 #endif
                     data[0] = 0x01;
                     for (data_cnt = 0; data_cnt < SIGFOX_DL_PAYLOAD_SIZE_BYTES; data_cnt++) {
@@ -312,10 +334,10 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_process_fn(void)
                 message_param.message_cplt_cb = &_SIGFOX_EP_API_message_cplt_cb;
 #endif
 #ifdef SIGFOX_EP_ERROR_CODES
-                sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+                sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
                 SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-            SIGFOX_EP_API_TEST_send_application_message(&message_param, &test_param);
+            SIGFOX_RFP_COMMON_send_application_message(&message_param, &test_param);
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
                 _SIGFOX_EP_API_message_cplt_cb();
@@ -328,6 +350,12 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_F_process_fn(void)
             if (sigfox_rfp_test_mode_f_ctx.flags.ep_api_message_cplt == 1) {
                 sigfox_rfp_test_mode_f_ctx.flags.ep_api_message_cplt = 0;
                 message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+                SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+                SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
                 if (message_status.field.execution_error == 1) {
                     goto errors;
                 }
@@ -366,4 +394,33 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_F_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_f_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_F_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode F.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_F_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+    sfx_u32 duration_ms = 0;
+#ifdef SIGFOX_EP_T_CONF_MS
+    sfx_u32 t_conf_ms = SIGFOX_EP_T_CONF_MS;
+#else
+    sfx_u32 t_conf_ms = 2000;
+#endif
+    // Bidirectional message with full downlink window (upper bound) and confirmation.
+    duration_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 3, 500);
+    duration_ms += SIGFOX_RFP_COMMON_DEFAULT_DL_T_W_MS + SIGFOX_RFP_COMMON_DEFAULT_DL_T_RX_MS + t_conf_ms;
+    duration_ms += SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_KEEP_ALIVE_PAYLOAD_BYTES, 3, 500);
+    // Check-up message.
+    duration_ms += SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 1, 500);
+    plan->number_of_messages = 2;
+    plan->number_of_frames = (sfx_u16) ((2 * SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(3)) + 1);
+    plan->duration_ms = duration_ms;
+    plan->open_ended = SIGFOX_FALSE;
+}
+#endif
 #endif // SIGFOX_EP_CERTIFICATION
@@ -37,8 +37,15 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 #if (defined SIGFOX_EP_CERTIFICATION) && ((defined SIGFOX_EP_SPECTRUM_ACCESS_LBT))
 
 #ifndef SIGFOX_EP_SINGLE_FRAME
@@ -49,6 +56,14 @@
 #else
 #define LOOP 2
 #endif
+#define CS_MAX_DURATION_FIRST_FRAME_MS 12000
+
+// The number of messages depends on the profiling plan when the LBT profiler is enabled.
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+#define NUMBER_OF_LOOPS (sigfox_rfp_test_mode_g_ctx.number_of_loops)
+#else
+#define NUMBER_OF_LOOPS LOOP
+#endif
 
 typedef struct {
     struct {
@@ -56,18 +71,31 @@ typedef struct {
         sfx_u8 test_mode_req          : 1;
     }flags;
     SIGFOX_RFP_test_mode_t test_mode;
-    sfx_u8 loop_iter;
+    sfx_u16 loop_iter;
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    sfx_u16 number_of_loops;
+    sfx_u32 message_start_ms;
+    sfx_u32 message_end_ms;
+    sfx_u32 message_frame_ms;
+    sfx_u32 message_ifu_ms;
+#endif
     SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
 } SIGFOX_RFP_TEST_MODE_G_context_t;
 
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_G_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_G_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_G_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_G_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_G_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_G_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_G_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_G_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_G_plan_fn,
+#endif
 };
 
 static SIGFOX_RFP_TEST_MODE_G_context_t sigfox_rfp_test_mode_g_ctx = {
@@ -83,6 +111,15 @@ static SIGFOX_RFP_TEST_MODE_G_context_t sigfox_rfp_test_mode_g_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .test_mode.process_cb           = SIGFOX_NULL,
     .test_mode.cplt_cb              = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    .test_mode.lbt_profile          = SIGFOX_NULL,
+    .test_mode.get_time_ms          = SIGFOX_NULL,
+    .number_of_loops                = LOOP,
+    .message_start_ms               = 0,
+    .message_end_ms                 = 0,
+    .message_frame_ms               = 0,
+    .message_ifu_ms                 = 0,
 #endif
     .loop_iter                      = 0,
     .progress_status.status.error   = 0,
@@ -98,6 +135,11 @@ static SIGFOX_RFP_TEST_MODE_G_context_t sigfox_rfp_test_mode_g_ctx = {
  *******************************************************************/
 static void _SIGFOX_EP_API_message_cplt_cb(void) {
     // Local variables.
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    if (sigfox_rfp_test_mode_g_ctx.test_mode.lbt_profile != SIGFOX_NULL) {
+        sigfox_rfp_test_mode_g_ctx.message_end_ms = sigfox_rfp_test_mode_g_ctx.test_mode.get_time_ms();
+    }
+#endif
     sigfox_rfp_test_mode_g_ctx.flags.ep_api_message_cplt = 1;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     if (sigfox_rfp_test_mode_g_ctx.test_mode.process_cb != SIGFOX_NULL) {
@@ -106,6 +148,58 @@ static void _SIGFOX_EP_API_message_cplt_cb(void) {
 #endif
 }
 
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_lbt_stats_t *_get_lbt_stats(void)
+ * \brief Get the statistics of the channel and carrier sense duration of the current message.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Statistics entry, NULL when the test mode is not profiling.
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_API_lbt_stats_t *_get_lbt_stats(void) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_RFP_API_lbt_profile_t *lbt_profile = sigfox_rfp_test_mode_g_ctx.test_mode.lbt_profile;
+    if (lbt_profile == SIGFOX_NULL) {
+        return SIGFOX_NULL;
+    }
+    // Messages are grouped by channel, and channels by sweep step.
+    return &((lbt_profile->stats_table)[sigfox_rfp_test_mode_g_ctx.loop_iter / (lbt_profile->number_of_messages)]);
+}
+
+/*!******************************************************************
+ * \fn static void _add_lbt_stats(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Account the carrier sense outcomes of the completed message.
+ * \param[in]   message_status: Status of the completed message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _add_lbt_stats(SIGFOX_EP_API_message_status_t message_status) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_lbt_stats_t *lbt_stats = _get_lbt_stats();
+    sfx_u8 number_of_frames = SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(3);
+    sfx_u8 number_of_clear = (sfx_u8) (message_status.field.ul_frame_1 + message_status.field.ul_frame_2 + message_status.field.ul_frame_3);
+    sfx_u32 duration_ms = sigfox_rfp_test_mode_g_ctx.message_end_ms - sigfox_rfp_test_mode_g_ctx.message_start_ms;
+    sfx_u32 on_air_ms = 0;
+    if (lbt_stats == SIGFOX_NULL) {
+        return;
+    }
+    if (number_of_clear > number_of_frames) {
+        number_of_clear = number_of_frames;
+    }
+    lbt_stats->number_of_attempts = (sfx_u16) (lbt_stats->number_of_attempts + number_of_frames);
+    lbt_stats->number_of_clear = (sfx_u16) (lbt_stats->number_of_clear + number_of_clear);
+    lbt_stats->number_of_busy = (sfx_u16) (lbt_stats->number_of_busy + (number_of_frames - number_of_clear));
+    // Whatever is not spent transmitting the sent frames or waiting between them is spent sensing.
+    on_air_ms = number_of_clear * sigfox_rfp_test_mode_g_ctx.message_frame_ms;
+    if ((number_of_clear > 1) && (number_of_frames > 1)) {
+        on_air_ms += ((number_of_clear - 1) * sigfox_rfp_test_mode_g_ctx.message_ifu_ms) / (number_of_frames - 1);
+    }
+    if (duration_ms > on_air_ms) {
+        lbt_stats->cs_time_ms += duration_ms - on_air_ms;
+    }
+}
+#endif
+
 /*!******************************************************************
  * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void)
  * \brief Send application message
@@ -129,6 +223,10 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #endif
 #else
     SIGFOX_EP_API_control_message_t application_message = {0};
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    SIGFOX_EP_ADDON_RFP_API_lbt_stats_t *lbt_stats = _get_lbt_stats();
+    SIGFOX_RFP_COMMON_airtime_t airtime;
 #endif
     // Configure application message structure
 #ifndef SIGFOX_EP_UL_BIT_RATE_BPS
@@ -148,6 +246,11 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
     application_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PRIVATE;
 #endif
     test_param.tx_frequency_hz = 0;
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    if (lbt_stats != SIGFOX_NULL) {
+        test_param.tx_frequency_hz = lbt_stats->tx_frequency_hz;
+    }
+#endif
 #ifdef SIGFOX_EP_BIDIRECTIONAL
     test_param.rx_frequency_hz = 0;
     test_param.dl_t_rx_ms = 0;
@@ -158,7 +261,12 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
     test_param.flags.field.tx_control_fh_enable = SIGFOX_FALSE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
-    test_param.lbt_cs_max_duration_first_frame_ms = 12000;
+    test_param.lbt_cs_max_duration_first_frame_ms = CS_MAX_DURATION_FIRST_FRAME_MS;
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    if (lbt_stats != SIGFOX_NULL) {
+        test_param.lbt_cs_max_duration_first_frame_ms = lbt_stats->cs_max_duration_first_frame_ms;
+    }
+#endif
     test_param.flags.field.tx_control_lbt_enable = SIGFOX_TRUE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)
@@ -185,20 +293,31 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
     application_message.uplink_cplt_cb = SIGFOX_NULL;
     application_message.message_cplt_cb = &_SIGFOX_EP_API_message_cplt_cb;
 #endif
-
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    if (lbt_stats != SIGFOX_NULL) {
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+        SIGFOX_RFP_COMMON_get_application_message_airtime(&application_message, &test_param, &airtime);
+#else
+        SIGFOX_RFP_COMMON_get_control_message_airtime(&application_message, &test_param, &airtime);
+#endif
+        sigfox_rfp_test_mode_g_ctx.message_frame_ms = airtime.tx_ms / SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(3);
+        sigfox_rfp_test_mode_g_ctx.message_ifu_ms = airtime.ifu_ms;
+        sigfox_rfp_test_mode_g_ctx.message_start_ms = sigfox_rfp_test_mode_g_ctx.test_mode.get_time_ms();
+    }
+#endif
     // Send Application message
 #ifdef SIGFOX_EP_ERROR_CODES
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
@@ -221,6 +340,12 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_G_init_fn(SIGFOX_RF
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    const SIGFOX_EP_ADDON_RFP_API_lbt_profile_t *lbt_profile = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_RFP_API_lbt_stats_t *lbt_stats = SIGFOX_NULL;
+    sfx_u8 cs_step_idx = 0;
+    sfx_u8 channel_idx = 0;
+#endif
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
     if (rfp_test_mode == SIGFOX_NULL) {
 #ifdef SIGFOX_EP_ERROR_CODES
@@ -246,6 +371,28 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_G_init_fn(SIGFOX_RF
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     sigfox_rfp_test_mode_g_ctx.test_mode.process_cb = rfp_test_mode->process_cb;
     sigfox_rfp_test_mode_g_ctx.test_mode.cplt_cb = rfp_test_mode->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    lbt_profile = rfp_test_mode->lbt_profile;
+    sigfox_rfp_test_mode_g_ctx.test_mode.lbt_profile = lbt_profile;
+    sigfox_rfp_test_mode_g_ctx.test_mode.get_time_ms = rfp_test_mode->get_time_ms;
+    sigfox_rfp_test_mode_g_ctx.number_of_loops = LOOP;
+    if (lbt_profile != SIGFOX_NULL) {
+        sigfox_rfp_test_mode_g_ctx.number_of_loops = (sfx_u16) ((lbt_profile->number_of_cs_steps) * (lbt_profile->number_of_channels) * (lbt_profile->number_of_messages));
+        // Reset the statistics table.
+        lbt_stats = lbt_profile->stats_table;
+        for (cs_step_idx = 0; cs_step_idx < (lbt_profile->number_of_cs_steps); cs_step_idx++) {
+            for (channel_idx = 0; channel_idx < (lbt_profile->number_of_channels); channel_idx++) {
+                lbt_stats->tx_frequency_hz = (lbt_profile->channel_list_hz)[channel_idx];
+                lbt_stats->cs_max_duration_first_frame_ms = (lbt_profile->cs_max_duration_first_frame_ms) + (cs_step_idx * (lbt_profile->cs_max_duration_step_ms));
+                lbt_stats->number_of_attempts = 0;
+                lbt_stats->number_of_clear = 0;
+                lbt_stats->number_of_busy = 0;
+                lbt_stats->cs_time_ms = 0;
+                lbt_stats++;
+            }
+        }
+    }
 #endif
     sigfox_rfp_test_mode_g_ctx.flags.test_mode_req = 1;
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
@@ -264,34 +411,42 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_G_process_fn(void) {
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
-#endif
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    sfx_u16 tmp;
 #endif
     SIGFOX_EP_API_message_status_t message_status;
-
-    if (sigfox_rfp_test_mode_g_ctx.flags.test_mode_req == 1) {
-        sigfox_rfp_test_mode_g_ctx.flags.test_mode_req = 0;
+    sfx_u32 tmp;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    // Run the test mode until completion.
+    while (sigfox_rfp_test_mode_g_ctx.progress_status.progress < 100) {
+#endif
+        if (sigfox_rfp_test_mode_g_ctx.flags.test_mode_req == 1) {
+            sigfox_rfp_test_mode_g_ctx.flags.test_mode_req = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-        status = _send_application_message();
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = _send_application_message();
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-        _send_application_message();
+            _send_application_message();
 #endif
-    }
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    else {
-        if (sigfox_rfp_test_mode_g_ctx.flags.ep_api_message_cplt == 1) {
+        }
+        else if (sigfox_rfp_test_mode_g_ctx.flags.ep_api_message_cplt == 1) {
             sigfox_rfp_test_mode_g_ctx.flags.ep_api_message_cplt = 0;
             message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+            SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+            SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
             if (message_status.field.execution_error == 1) {
                 goto errors;
             }
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+            _add_lbt_stats(message_status);
+#endif
             sigfox_rfp_test_mode_g_ctx.loop_iter++;
-            if (sigfox_rfp_test_mode_g_ctx.loop_iter < LOOP) {
-                tmp = 100 * (sigfox_rfp_test_mode_g_ctx.loop_iter);
-                tmp /= LOOP;
-                sigfox_rfp_test_mode_g_ctx.progress_status.progress = (sfx_u8) tmp;
+            tmp = 100 * ((sfx_u32) sigfox_rfp_test_mode_g_ctx.loop_iter);
+            tmp /= NUMBER_OF_LOOPS;
+            sigfox_rfp_test_mode_g_ctx.progress_status.progress = (sfx_u8) tmp;
+            if (sigfox_rfp_test_mode_g_ctx.loop_iter < NUMBER_OF_LOOPS) {
 #ifdef SIGFOX_EP_ERROR_CODES
                 status = _send_application_message();
                 SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
@@ -299,35 +454,17 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_G_process_fn(void)
                 _send_application_message();
 #endif
             } else {
+                sigfox_rfp_test_mode_g_ctx.progress_status.progress = 100;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
                 if (sigfox_rfp_test_mode_g_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
-                    sigfox_rfp_test_mode_g_ctx.progress_status.progress = 100;
                     sigfox_rfp_test_mode_g_ctx.test_mode.cplt_cb();
                 }
-            }
-        }
-    }
-#else
-    while (sigfox_rfp_test_mode_g_ctx.loop_iter < LOOP) {
-        if (sigfox_rfp_test_mode_g_ctx.flags.ep_api_message_cplt == 1) {
-            sigfox_rfp_test_mode_g_ctx.flags.ep_api_message_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1) {
-                goto errors;
-            }
-            sigfox_rfp_test_mode_g_ctx.loop_iter++;
-            if (sigfox_rfp_test_mode_g_ctx.loop_iter < LOOP) {
-#ifdef SIGFOX_EP_ERROR_CODES
-                status = _send_application_message();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else
-                _send_application_message();
 #endif
             }
         }
+#ifndef SIGFOX_EP_ASYNCHRONOUS
     }
-    sigfox_rfp_test_mode_g_ctx.progress_status.progress = 100;
 #endif
-
     SIGFOX_RETURN();
 errors:
     sigfox_rfp_test_mode_g_ctx.progress_status.status.error = 1;
@@ -348,4 +485,33 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_G_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_g_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_G_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode G.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_G_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+#ifdef INTERFRAME_MS
+    sfx_u32 message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 3, INTERFRAME_MS);
+#else
+    sfx_u32 message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 3, 0);
+#endif
+    sfx_u16 number_of_loops = LOOP;
+#ifdef SIGFOX_EP_ADDON_RFP_LBT_PROFILER
+    if (rfp_test_mode->lbt_profile != SIGFOX_NULL) {
+        number_of_loops = (sfx_u16) (((rfp_test_mode->lbt_profile)->number_of_cs_steps) * ((rfp_test_mode->lbt_profile)->number_of_channels) * ((rfp_test_mode->lbt_profile)->number_of_messages));
+    }
+#endif
+    // Back to back messages, carrier sense time excluded.
+    plan->number_of_messages = number_of_loops;
+    plan->number_of_frames = (sfx_u16) (number_of_loops * SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(3));
+    plan->duration_ms = number_of_loops * message_ms;
+    plan->open_ended = SIGFOX_FALSE;
+}
+#endif
 #endif // SIGFOX_EP_CERTIFICATION
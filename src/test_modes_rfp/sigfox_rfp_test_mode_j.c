@@ -45,14 +45,41 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "manuf/mcu_api.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+#include "test_modes_rfp/sigfox_rfp_throughput.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+#include "test_modes_rfp/sigfox_rfp_soak.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 #ifdef SIGFOX_EP_CERTIFICATION
 
 #define WINDOW_TIME_MS 18000
 #define START_PAYLOAD 0x40
 
+// Spectrum access controls are disabled unless the throughput is measured under regulatory constraints.
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+#define TX_CONTROL_ENABLE (sigfox_rfp_test_mode_j_ctx.test_mode.regulatory_controls)
+#else
+#define TX_CONTROL_ENABLE SIGFOX_FALSE
+#endif
+
+// Message errors are counted instead of ending a soaked test mode.
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+#define SOAK_ENABLE (sigfox_rfp_test_mode_j_ctx.test_mode.soak)
+#else
+#define SOAK_ENABLE SIGFOX_FALSE
+#endif
+
 typedef struct test_mode_j_message_s test_mode_j_message_t;
 typedef struct test_mode_j_message_s {
     SIGFOX_EP_ADDON_RFP_API_status_t (*send_ptr)(const test_mode_j_message_t *test_mode_j_message);
@@ -83,6 +110,9 @@ typedef struct {
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_J_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_J_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_J_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_J_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 #ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
 static SIGFOX_EP_ADDON_RFP_API_status_t _send_control_message(const test_mode_j_message_t *test_mode_j_message);
 #endif
@@ -94,6 +124,9 @@ const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_J_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_J_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_J_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_J_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_J_plan_fn,
+#endif
 };
 
 static const test_mode_j_message_t MESSAGE_LIST[] = {
@@ -149,6 +182,15 @@ static SIGFOX_RFP_TEST_MODE_J_context_t sigfox_rfp_test_mode_j_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .test_mode.process_cb = SIGFOX_NULL,
     .test_mode.cplt_cb = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    .test_mode.checkpoint_cb = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    .test_mode.regulatory_controls = SIGFOX_FALSE,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    .test_mode.soak = SIGFOX_FALSE,
 #endif
     .progress_status.status.error = 0,
     .progress_status.progress = 0,
@@ -163,6 +205,12 @@ static SIGFOX_RFP_TEST_MODE_J_context_t sigfox_rfp_test_mode_j_ctx = {
  *******************************************************************/
 static void _SIGFOX_EP_API_message_cplt_cb(void) {
     // Local variables.
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    SIGFOX_RFP_THROUGHPUT_message_cplt();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    SIGFOX_RFP_SOAK_message_cplt();
+#endif
     sigfox_rfp_test_mode_j_ctx.flags.ep_api_message_cplt = 1;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     if (sigfox_rfp_test_mode_j_ctx.test_mode.process_cb != SIGFOX_NULL) {
@@ -229,14 +277,14 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_control_message(const test_mode_j_
 #endif
     test_param.flags.all = 0xFF;
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_FH)
-    test_param.flags.field.tx_control_fh_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_fh_enable = TX_CONTROL_ENABLE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
     test_param.lbt_cs_max_duration_first_frame_ms = 0;
-    test_param.flags.field.tx_control_lbt_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_lbt_enable = TX_CONTROL_ENABLE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)
-    test_param.flags.field.tx_control_ldc_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_ldc_enable = TX_CONTROL_ENABLE;
 #endif
     control_message.type = test_mode_j_message->type.control_type;
 #ifdef SIGFOX_EP_ASYNCHRONOUS
@@ -247,26 +295,29 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_control_message(const test_mode_j_
     // Configure timer structure
     timer.duration_ms = WINDOW_TIME_MS;
     timer.instance = MCU_API_TIMER_INSTANCE_ADDON_RFP;
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    SIGFOX_RFP_SOAK_start_window(WINDOW_TIME_MS);
+    SIGFOX_RFP_SOAK_start_message();
+#endif
     // Configure timer and send control message
 #ifdef SIGFOX_EP_ERROR_CODES
-    mcu_api_status = MCU_API_timer_start(&timer);
+    mcu_api_status = SIGFOX_RFP_COMMON_timer_start(&timer);
     MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_control_message(&control_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_control_message(&control_message, &test_param);
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-    MCU_API_timer_start(&timer);
-    SIGFOX_EP_API_TEST_send_control_message(&control_message, &test_param);
+    SIGFOX_RFP_COMMON_timer_start(&timer);
+    SIGFOX_RFP_COMMON_send_control_message(&control_message, &test_param);
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
     _SIGFOX_EP_API_message_cplt_cb();
+#endif
+    // Wait for the end of the window.
 #ifdef SIGFOX_EP_ERROR_CODES
-    mcu_api_status = MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+    mcu_api_status = SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
     MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-    MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-#endif
-    _MCU_API_timer_cplt_cb();
-
+    SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
 #endif
 #ifdef SIGFOX_EP_ERROR_CODES
 errors:
@@ -320,13 +371,13 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(const test_mod
     test_param.tx_frequency_hz = 0;
     test_param.flags.all = 0xFF;
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_FH)
-    test_param.flags.field.tx_control_fh_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_fh_enable = TX_CONTROL_ENABLE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
-    test_param.flags.field.tx_control_lbt_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_lbt_enable = TX_CONTROL_ENABLE;
 #endif
 #if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)
-    test_param.flags.field.tx_control_ldc_enable = SIGFOX_FALSE;
+    test_param.flags.field.tx_control_ldc_enable = TX_CONTROL_ENABLE;
 #endif
     application_message.type = test_mode_j_message->type.message_type;
 #ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
@@ -352,26 +403,29 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(const test_mod
     timer.duration_ms = WINDOW_TIME_MS;
     timer.instance = MCU_API_TIMER_INSTANCE_ADDON_RFP;
     timer.reason = MCU_API_TIMER_REASON_ADDON_RFP;
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    SIGFOX_RFP_SOAK_start_window(WINDOW_TIME_MS);
+    SIGFOX_RFP_SOAK_start_message();
+#endif
     // Start timer and send Application message
 #ifdef SIGFOX_EP_ERROR_CODES
-    mcu_api_status = MCU_API_timer_start(&timer);
+    mcu_api_status = SIGFOX_RFP_COMMON_timer_start(&timer);
     MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-    MCU_API_timer_start(&timer);
-    SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_timer_start(&timer);
+    SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
     _SIGFOX_EP_API_message_cplt_cb();
+#endif
+    // Wait for the end of the window.
 #ifdef SIGFOX_EP_ERROR_CODES
-    mcu_api_status = MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+    mcu_api_status = SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
     MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-    MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-#endif
-    _MCU_API_timer_cplt_cb();
-
+    SIGFOX_RFP_COMMON_timer_wait_cplt(&_MCU_API_timer_cplt_cb);
 #endif
 #ifdef SIGFOX_EP_ERROR_CODES
 errors:
@@ -412,11 +466,25 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_J_init_fn(SIGFOX_RF
     sigfox_rfp_test_mode_j_ctx.test_mode.ul_bit_rate = rfp_test_mode->ul_bit_rate;
 #endif
 #ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
-    sigfox_rfp_test_mode_j_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp,
+    sigfox_rfp_test_mode_j_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp;
 #endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     sigfox_rfp_test_mode_j_ctx.test_mode.process_cb = rfp_test_mode->process_cb;
     sigfox_rfp_test_mode_j_ctx.test_mode.cplt_cb = rfp_test_mode->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+    sigfox_rfp_test_mode_j_ctx.test_mode.regulatory_controls = rfp_test_mode->regulatory_controls;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    sigfox_rfp_test_mode_j_ctx.test_mode.soak = rfp_test_mode->soak;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+    // Each message has its own window: resume after the last completed one.
+    if (rfp_test_mode->start_step < (sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t))) {
+        sigfox_rfp_test_mode_j_ctx.message_list_idx = (sfx_u8) rfp_test_mode->start_step;
+        sigfox_rfp_test_mode_j_ctx.progress_status.progress = (sfx_u8) ((100 * rfp_test_mode->start_step) / (sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t)));
+    }
+    sigfox_rfp_test_mode_j_ctx.test_mode.checkpoint_cb = rfp_test_mode->checkpoint_cb;
 #endif
     sigfox_rfp_test_mode_j_ctx.flags.test_mode_req = 1;
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
@@ -438,84 +506,87 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_J_process_fn(void)
     MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
 #endif
     SIGFOX_EP_API_message_status_t message_status;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
     sfx_u16 tmp;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    // Run the test mode until completion.
+    while (sigfox_rfp_test_mode_j_ctx.progress_status.progress < 100) {
 #endif
-
-    if (sigfox_rfp_test_mode_j_ctx.flags.test_mode_req == 1) {
-        sigfox_rfp_test_mode_j_ctx.flags.test_mode_req = 0;
+        if (sigfox_rfp_test_mode_j_ctx.flags.test_mode_req == 1) {
+            sigfox_rfp_test_mode_j_ctx.flags.test_mode_req = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-        status = MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-        MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
+            MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
 #endif
-    }
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    else {
-        if ((sigfox_rfp_test_mode_j_ctx.flags.ep_api_message_cplt == 1) && (sigfox_rfp_test_mode_j_ctx.flags.mcu_api_timer_cplt == 1)) {
+        }
+        else if ((sigfox_rfp_test_mode_j_ctx.flags.ep_api_message_cplt == 1) && (sigfox_rfp_test_mode_j_ctx.flags.mcu_api_timer_cplt == 1)) {
             sigfox_rfp_test_mode_j_ctx.flags.ep_api_message_cplt = 0;
             sigfox_rfp_test_mode_j_ctx.flags.mcu_api_timer_cplt = 0;
             message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+            SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+            SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+            SIGFOX_RFP_SOAK_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_THROUGHPUT
+            SIGFOX_RFP_THROUGHPUT_add_message_status(message_status);
+            if ((SOAK_ENABLE == SIGFOX_FALSE) && ((message_status.field.execution_error == 1) || ((message_status.field.network_error == 1) && (TX_CONTROL_ENABLE == SIGFOX_FALSE)))) {
                 goto errors;
             }
+#else
+            if ((SOAK_ENABLE == SIGFOX_FALSE) && (message_status.field.execution_error == 1 || message_status.field.network_error == 1)) {
+                goto errors;
+            }
+#endif
             sigfox_rfp_test_mode_j_ctx.message_list_idx++;
 #ifdef SIGFOX_EP_ERROR_CODES
-            mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+            mcu_api_status = SIGFOX_RFP_COMMON_timer_stop();
             MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
 #else
-            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+            SIGFOX_RFP_COMMON_timer_stop();
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+            SIGFOX_RFP_SOAK_end_window();
+            // Repeat the message list until the test mode is aborted.
+            if ((sigfox_rfp_test_mode_j_ctx.message_list_idx >= (sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t))) && (sigfox_rfp_test_mode_j_ctx.test_mode.soak == SIGFOX_TRUE)) {
+                SIGFOX_RFP_SOAK_end_iteration();
+                sigfox_rfp_test_mode_j_ctx.message_list_idx = 0;
+            }
 #endif
             if (sigfox_rfp_test_mode_j_ctx.message_list_idx < sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t)) {
                 tmp = 100 * (sigfox_rfp_test_mode_j_ctx.message_list_idx);
                 tmp /= (sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t));
                 sigfox_rfp_test_mode_j_ctx.progress_status.progress = (sfx_u8) tmp;
+#ifdef SIGFOX_EP_ADDON_RFP_CHECKPOINT
+                if (sigfox_rfp_test_mode_j_ctx.test_mode.checkpoint_cb != SIGFOX_NULL) {
+                    sigfox_rfp_test_mode_j_ctx.test_mode.checkpoint_cb(sigfox_rfp_test_mode_j_ctx.message_list_idx, 0);
+                }
+#endif
 #ifdef SIGFOX_EP_ERROR_CODES
-
                 status = MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
                 if (status != SIGFOX_EP_ADDON_RFP_API_SUCCESS) {
-                    MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+                    SIGFOX_RFP_COMMON_timer_stop();
                     goto errors;
                 }
 #else
                 MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
 #endif
             } else {
+                sigfox_rfp_test_mode_j_ctx.progress_status.progress = 100;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
                 if (sigfox_rfp_test_mode_j_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
-                    sigfox_rfp_test_mode_j_ctx.progress_status.progress = 100;
                     sigfox_rfp_test_mode_j_ctx.test_mode.cplt_cb();
                 }
-            }
-        }
-    }
-#else
-    while (sigfox_rfp_test_mode_j_ctx.message_list_idx < sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t)) {
-        if ((sigfox_rfp_test_mode_j_ctx.flags.ep_api_message_cplt == 1) && (sigfox_rfp_test_mode_j_ctx.flags.mcu_api_timer_cplt == 1)) {
-            sigfox_rfp_test_mode_j_ctx.flags.ep_api_message_cplt = 0;
-            sigfox_rfp_test_mode_j_ctx.flags.mcu_api_timer_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
-                goto errors;
-            }
-#ifdef SIGFOX_EP_ERROR_CODES
-            mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-            MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
-#else
-            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
-#endif
-            sigfox_rfp_test_mode_j_ctx.message_list_idx++;
-            if (sigfox_rfp_test_mode_j_ctx.message_list_idx < sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t)) {
-#ifdef SIGFOX_EP_ERROR_CODES
-                status = MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else
-                MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_j_ctx.message_list_idx]);
 #endif
             }
         }
+#ifndef SIGFOX_EP_ASYNCHRONOUS
     }
-    sigfox_rfp_test_mode_j_ctx.progress_status.progress = 100;
 #endif
     SIGFOX_RETURN();
 errors:
@@ -537,4 +608,52 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_J_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_j_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_J_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode J.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_J_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    sfx_u8 ul_payload_size_bytes = 0;
+    sfx_u32 message_ms = 0;
+    plan->number_of_messages = 0;
+    plan->number_of_frames = 0;
+    plan->duration_ms = 0;
+    plan->open_ended = SIGFOX_FALSE;
+    // One message of the list per window.
+    for (idx = 0; idx < (sizeof(MESSAGE_LIST) / sizeof(test_mode_j_message_t)); idx++) {
+        ul_payload_size_bytes = 0;
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+        if (MESSAGE_LIST[idx].send_ptr == &_send_control_message) {
+            ul_payload_size_bytes = SIGFOX_RFP_COMMON_KEEP_ALIVE_PAYLOAD_BYTES;
+        }
+#endif
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+        if ((MESSAGE_LIST[idx].send_ptr == &_send_application_message) && (MESSAGE_LIST[idx].type.message_type == SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY)) {
+#ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
+            ul_payload_size_bytes = SIGFOX_EP_UL_PAYLOAD_SIZE;
+#else
+            ul_payload_size_bytes = MESSAGE_LIST[idx].size;
+#endif
+        }
+#endif
+        message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, ul_payload_size_bytes, 3, 500);
+        plan->number_of_messages++;
+        plan->number_of_frames = (sfx_u16) (plan->number_of_frames + SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(3));
+        plan->duration_ms += ((message_ms > WINDOW_TIME_MS) ? message_ms : WINDOW_TIME_MS);
+    }
+#ifdef SIGFOX_EP_ADDON_RFP_SOAK
+    // The plan covers one pass of the message list.
+    if (rfp_test_mode->soak == SIGFOX_TRUE) {
+        plan->open_ended = SIGFOX_TRUE;
+    }
+#endif
+}
+#endif
 #endif
@@ -3,7 +3,8 @@
  * \brief   Sigfox addon RF & Protocol test mode K module
  * \details \arg Switch the device in public key
  *
- *          \arg Send one of the supported types of Sigfox messages* without downlink request
+ *          \arg Send all the supported types of Sigfox messages without downlink request:
+ *          bits (0 and 1), Keep-Alive Control Message, frames with 1 to 12 bytes of payload and empty frame.
  *
  *          \arg Switch the device back to private key.
  *
@@ -41,15 +42,42 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 #if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_PUBLIC_KEY_CAPABLE)
 
+#define PAYLOAD_BYTE 0xAA
+#define INTERFRAME_MS 1000
+
+typedef struct test_mode_k_message_s test_mode_k_message_t;
+typedef struct test_mode_k_message_s {
+    SIGFOX_EP_ADDON_RFP_API_status_t (*send_ptr)(const test_mode_k_message_t *test_mode_k_message);
+#ifndef SIGFOX_EP_UL_PAYLOAD_SIZE
+    sfx_u8 size;
+#endif
+    union {
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+        SIGFOX_application_message_type_t message_type;
+#endif
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+        SIGFOX_control_message_type_t control_type;
+#endif
+    } type;
+} test_mode_k_message_t;
+
 typedef struct {
     struct {
         sfx_u8 ep_api_message_cplt    : 1;
         sfx_u8 test_mode_req          : 1;
     }flags;
+    sfx_u8 message_list_idx;
     SIGFOX_RFP_test_mode_t test_mode;
     SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
 } SIGFOX_RFP_TEST_MODE_K_context_t;
@@ -57,16 +85,69 @@ typedef struct {
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_K_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_K_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_K_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_K_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+static SIGFOX_EP_ADDON_RFP_API_status_t _send_control_message(const test_mode_k_message_t *test_mode_k_message);
+#endif
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(const test_mode_k_message_t *test_mode_k_message);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_K_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_K_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_K_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_K_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_K_plan_fn,
+#endif
+};
+
+// Same catalogue as test mode J, sent with the public key.
+static const test_mode_k_message_t MESSAGE_LIST[] = {
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+#ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
+#if (SIGFOX_EP_UL_PAYLOAD_SIZE == 0)
+    {.send_ptr = &_send_application_message, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BIT0},
+    {.send_ptr = &_send_application_message, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BIT1},
+    {.send_ptr = &_send_application_message, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_EMPTY},
+#else
+    {.send_ptr = &_send_application_message, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+#endif
+#else
+    {.send_ptr = &_send_application_message, .size = 0, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BIT0},
+    {.send_ptr = &_send_application_message, .size = 0, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BIT1},
+    {.send_ptr = &_send_application_message, .size = 1, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 2, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 3, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 4, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 5, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 6, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 7, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 8, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 9, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 10, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 11, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 12, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY},
+    {.send_ptr = &_send_application_message, .size = 0, .type.message_type = SIGFOX_APPLICATION_MESSAGE_TYPE_EMPTY},
+#endif
+#endif
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+#ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
+    {.send_ptr = &_send_control_message, .type.control_type = SIGFOX_CONTROL_MESSAGE_TYPE_KEEP_ALIVE},
+#else
+    {.send_ptr = &_send_control_message, .size = 0, .type.control_type = SIGFOX_CONTROL_MESSAGE_TYPE_KEEP_ALIVE},
+#endif
+#endif
 };
 
+#define MESSAGE_LIST_SIZE (sizeof(MESSAGE_LIST) / sizeof(test_mode_k_message_t))
+
 static SIGFOX_RFP_TEST_MODE_K_context_t sigfox_rfp_test_mode_k_ctx = {
     .flags.ep_api_message_cplt      = 0,
     .flags.test_mode_req            = 0,
+    .message_list_idx               = 0,
     .test_mode.rc                   = SIGFOX_NULL,
 #ifndef SIGFOX_EP_UL_BIT_RATE_BPS
     .test_mode.ul_bit_rate          = 0,
@@ -77,14 +158,17 @@ static SIGFOX_RFP_TEST_MODE_K_context_t sigfox_rfp_test_mode_k_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .test_mode.process_cb           = SIGFOX_NULL,
     .test_mode.cplt_cb              = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+    .test_mode.public_key_report    = SIGFOX_NULL,
 #endif
     .progress_status.status.error   = 0,
     .progress_status.progress       = 0,
 };
 
 /*!******************************************************************
- * \fn static void _SIGFOX_RFP_TEST_MODE_completion_callback(void)
- * \brief Execute the rfp test mode completion callback if the not null.
+ * \fn static void _SIGFOX_EP_API_message_cplt_cb(void)
+ * \brief Message completion callback.
  * \param[in]   none
  * \param[out]  none
  * \retval      none
@@ -99,28 +183,107 @@ static void _SIGFOX_EP_API_message_cplt_cb(void) {
 }
 
 /*!******************************************************************
- * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void)
- * \brief Send application message
+ * \fn static void _set_test_parameters(SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Disable the spectrum access controls and use the default frequencies.
  * \param[in]   none
+ * \param[out]  test_param: Test parameters to fill.
+ * \retval      none
+ *******************************************************************/
+static void _set_test_parameters(SIGFOX_EP_API_TEST_parameters_t *test_param) {
+    test_param->tx_frequency_hz = 0;
+#ifdef SIGFOX_EP_BIDIRECTIONAL
+    test_param->rx_frequency_hz = 0;
+    test_param->dl_t_rx_ms = 0;
+    test_param->dl_t_w_ms = 0;
+#endif
+    test_param->flags.all = 0xFF;
+#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_FH)
+    test_param->flags.field.tx_control_fh_enable = SIGFOX_FALSE;
+#endif
+#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
+    test_param->lbt_cs_max_duration_first_frame_ms = 0;
+    test_param->flags.field.tx_control_lbt_enable = SIGFOX_FALSE;
+#endif
+#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)
+    test_param->flags.field.tx_control_ldc_enable = SIGFOX_FALSE;
+#endif
+}
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _send_control_message(const test_mode_k_message_t *test_mode_k_message)
+ * \brief Send control message with the public key.
+ * \param[in]   test_mode_k_message: message to send
  * \param[out]  none
  * \retval      SIGFOX_EP_ADDON_RFP_API_status_t
  *******************************************************************/
-static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
+static SIGFOX_EP_ADDON_RFP_API_status_t _send_control_message(const test_mode_k_message_t *test_mode_k_message) {
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
     SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
 #endif
     SIGFOX_EP_API_TEST_parameters_t test_param = {0};
+    SIGFOX_EP_API_control_message_t control_message = {0};
+    // Configure control message structure
+#ifndef SIGFOX_EP_UL_BIT_RATE_BPS
+    control_message.common_parameters.ul_bit_rate = sigfox_rfp_test_mode_k_ctx.test_mode.ul_bit_rate;
+#endif
+#ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
+    control_message.common_parameters.tx_power_dbm_eirp = sigfox_rfp_test_mode_k_ctx.test_mode.tx_power_dbm_eirp;
+#endif
+#ifndef SIGFOX_EP_SINGLE_FRAME
+    control_message.common_parameters.number_of_frames = 3;
+#ifndef SIGFOX_EP_T_IFU_MS
+    control_message.common_parameters.t_ifu_ms = INTERFRAME_MS;
+#endif
+#endif
+    control_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PUBLIC;
+    _set_test_parameters(&test_param);
+    control_message.type = test_mode_k_message->type.control_type;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    control_message.uplink_cplt_cb = SIGFOX_NULL;
+    control_message.message_cplt_cb = &_SIGFOX_EP_API_message_cplt_cb;
+#endif
+    // Send control message
+#ifdef SIGFOX_EP_ERROR_CODES
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_control_message(&control_message, &test_param);
+    SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
+#else
+    SIGFOX_RFP_COMMON_send_control_message(&control_message, &test_param);
+#endif
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    _SIGFOX_EP_API_message_cplt_cb();
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(const test_mode_k_message_t *test_mode_k_message)
+ * \brief Send application message with the public key.
+ * \param[in]   test_mode_k_message: message to send
+ * \param[out]  none
+ * \retval      SIGFOX_EP_ADDON_RFP_API_status_t
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(const test_mode_k_message_t *test_mode_k_message) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    SIGFOX_EP_API_status_t sigfox_ep_api_status = SIGFOX_EP_API_SUCCESS;
+#endif
+    SIGFOX_EP_API_TEST_parameters_t test_param = {0};
     SIGFOX_EP_API_application_message_t application_message = {0};
 #ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
 #if (SIGFOX_EP_UL_PAYLOAD_SIZE != 0)
     sfx_u8 data_cnt;
     sfx_u8 data[SIGFOX_EP_UL_PAYLOAD_SIZE] = {0x00};
 #endif
-#endif
 #else
-    SIGFOX_EP_API_control_message_t application_message = {0};
+    sfx_u8 data_cnt;
+    sfx_u8 data[SIGFOX_UL_PAYLOAD_MAX_SIZE_BYTES] = {0x00};
 #endif
     // Configure application message structure
 #ifndef SIGFOX_EP_UL_BIT_RATE_BPS
@@ -133,66 +296,36 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #ifndef SIGFOX_EP_SINGLE_FRAME
     application_message.common_parameters.number_of_frames = 3;
 #ifndef SIGFOX_EP_T_IFU_MS
-    application_message.common_parameters.t_ifu_ms = 1000;
+    application_message.common_parameters.t_ifu_ms = INTERFRAME_MS;
 #endif
 #endif
-#ifdef SIGFOX_EP_PUBLIC_KEY_CAPABLE
     application_message.common_parameters.ep_key_type = SIGFOX_EP_KEY_PUBLIC;
-#endif
-    test_param.tx_frequency_hz = 0;
-#ifdef SIGFOX_EP_BIDIRECTIONAL
-    test_param.rx_frequency_hz = 0;
-    test_param.dl_t_rx_ms = 0;
-    test_param.dl_t_w_ms = 0;
-#endif
-    test_param.flags.all = 0xFF;
-#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_FH)
-    test_param.flags.field.tx_control_fh_enable = SIGFOX_FALSE;
-#endif
-#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LBT)
-    test_param.lbt_cs_max_duration_first_frame_ms = 0;
-    test_param.flags.field.tx_control_lbt_enable = SIGFOX_FALSE;
-#endif
-#if (defined SIGFOX_EP_REGULATORY) && (defined SIGFOX_EP_SPECTRUM_ACCESS_LDC)
-    test_param.flags.field.tx_control_ldc_enable = SIGFOX_FALSE;
-#endif
-#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+    _set_test_parameters(&test_param);
+    application_message.type = test_mode_k_message->type.message_type;
 #ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
-#if (SIGFOX_EP_UL_PAYLOAD_SIZE == 0)
-    application_message.type = SIGFOX_APPLICATION_MESSAGE_TYPE_EMPTY;
-#else
-    application_message.type = SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY;
+#if (SIGFOX_EP_UL_PAYLOAD_SIZE > 0)
     for (data_cnt = 0; data_cnt < SIGFOX_EP_UL_PAYLOAD_SIZE; data_cnt++) {
-        data[data_cnt] = (sfx_u8) 0xAA;
+        data[data_cnt] = PAYLOAD_BYTE;
     }
     application_message.ul_payload = data;
 #endif
 #else
-    application_message.type = SIGFOX_APPLICATION_MESSAGE_TYPE_EMPTY;
-
-#endif
-#else
-    application_message.type = SIGFOX_CONTROL_MESSAGE_TYPE_KEEP_ALIVE;
+    application_message.ul_payload_size_bytes = test_mode_k_message->size;
+    for (data_cnt = 0; data_cnt < test_mode_k_message->size; data_cnt++) {
+        data[data_cnt] = PAYLOAD_BYTE;
+    }
+    application_message.ul_payload = data;
 #endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     application_message.uplink_cplt_cb = SIGFOX_NULL;
     application_message.message_cplt_cb = &_SIGFOX_EP_API_message_cplt_cb;
 #endif
-
-    // Send Application message
+    // Send application message
 #ifdef SIGFOX_EP_ERROR_CODES
-#ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
-#else
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
-#endif
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
-#ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
-#else
-    SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
-#endif
+    SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
     _SIGFOX_EP_API_message_cplt_cb();
@@ -202,10 +335,103 @@ errors:
 #endif
     SIGFOX_RETURN();
 }
+#endif
+
+#if (defined SIGFOX_EP_ADDON_RFP_PLANNER) || (defined SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT)
+/*!******************************************************************
+ * \fn static sfx_u8 _get_ul_payload_size_bytes(const test_mode_k_message_t *test_mode_k_message)
+ * \brief Get the uplink payload size of a message of the list.
+ * \param[in]   test_mode_k_message: message of the list
+ * \param[out]  none
+ * \retval      Payload size in bytes.
+ *******************************************************************/
+static sfx_u8 _get_ul_payload_size_bytes(const test_mode_k_message_t *test_mode_k_message) {
+    // Local variables.
+    sfx_u8 ul_payload_size_bytes = 0;
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+    if (test_mode_k_message->send_ptr == &_send_control_message) {
+        ul_payload_size_bytes = SIGFOX_RFP_COMMON_KEEP_ALIVE_PAYLOAD_BYTES;
+    }
+#endif
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+    if ((test_mode_k_message->send_ptr == &_send_application_message) && (test_mode_k_message->type.message_type == SIGFOX_APPLICATION_MESSAGE_TYPE_BYTE_ARRAY)) {
+#ifdef SIGFOX_EP_UL_PAYLOAD_SIZE
+        ul_payload_size_bytes = SIGFOX_EP_UL_PAYLOAD_SIZE;
+#else
+        ul_payload_size_bytes = test_mode_k_message->size;
+#endif
+    }
+#endif
+    return ul_payload_size_bytes;
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+/*!******************************************************************
+ * \fn static void _reset_public_key_report(void)
+ * \brief Describe the messages of the list in the public key report.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _reset_public_key_report(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_public_key_report_t *public_key_report = sigfox_rfp_test_mode_k_ctx.test_mode.public_key_report;
+    SIGFOX_EP_ADDON_RFP_API_public_key_message_t *message = SIGFOX_NULL;
+    sfx_u8 idx = 0;
+    if (public_key_report == SIGFOX_NULL) {
+        return;
+    }
+    public_key_report->number_of_messages = (sfx_u8) MESSAGE_LIST_SIZE;
+    public_key_report->number_of_completed = 0;
+    public_key_report->number_of_frames_sent = 0;
+    for (idx = 0; idx < MESSAGE_LIST_SIZE; idx++) {
+        message = &((public_key_report->message)[idx]);
+        message->control_message = SIGFOX_FALSE;
+        message->message_type = 0;
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+        if (MESSAGE_LIST[idx].send_ptr == &_send_control_message) {
+            message->control_message = SIGFOX_TRUE;
+            message->message_type = (sfx_u8) MESSAGE_LIST[idx].type.control_type;
+        }
+#endif
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+        if (MESSAGE_LIST[idx].send_ptr == &_send_application_message) {
+            message->message_type = (sfx_u8) MESSAGE_LIST[idx].type.message_type;
+        }
+#endif
+        message->ul_payload_size_bytes = _get_ul_payload_size_bytes(&(MESSAGE_LIST[idx]));
+        message->ul_frames_status.all = 0;
+    }
+}
 
 /*!******************************************************************
- * \fn static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_C_start_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode)
- * \brief Start Test Mode C.
+ * \fn static void _add_public_key_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Record the frames result of the completed message.
+ * \param[in]   message_status: Status of the completed message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _add_public_key_message_status(SIGFOX_EP_API_message_status_t message_status) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_public_key_report_t *public_key_report = sigfox_rfp_test_mode_k_ctx.test_mode.public_key_report;
+    SIGFOX_EP_ADDON_RFP_API_ul_frames_status_t *ul_frames_status = SIGFOX_NULL;
+    if (public_key_report == SIGFOX_NULL) {
+        return;
+    }
+    ul_frames_status = &((public_key_report->message)[sigfox_rfp_test_mode_k_ctx.message_list_idx].ul_frames_status);
+    ul_frames_status->field.ul_frame_1 = message_status.field.ul_frame_1;
+    ul_frames_status->field.ul_frame_2 = message_status.field.ul_frame_2;
+    ul_frames_status->field.ul_frame_3 = message_status.field.ul_frame_3;
+    ul_frames_status->field.error = (message_status.field.execution_error | message_status.field.network_error);
+    public_key_report->number_of_completed++;
+    public_key_report->number_of_frames_sent = (sfx_u8) (public_key_report->number_of_frames_sent + message_status.field.ul_frame_1 + message_status.field.ul_frame_2 + message_status.field.ul_frame_3);
+}
+#endif
+
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_K_init_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode)
+ * \brief Start Test Mode K.
  * \param[in]   rfp_test_mode: test mode parameters
  * \param[out]  none
  * \retval      none
@@ -225,6 +451,7 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_K_init_fn(SIGFOX_RF
 #endif /* SIGFOX_EP_PARAMETERS_CHECK */
     // Reset static context
     sigfox_rfp_test_mode_k_ctx.flags.ep_api_message_cplt = 0;
+    sigfox_rfp_test_mode_k_ctx.message_list_idx = 0;
     sigfox_rfp_test_mode_k_ctx.progress_status.status.error = 0;
     sigfox_rfp_test_mode_k_ctx.progress_status.progress = 0;
     // Store test mode parameters locally.
@@ -233,11 +460,15 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_K_init_fn(SIGFOX_RF
     sigfox_rfp_test_mode_k_ctx.test_mode.ul_bit_rate = rfp_test_mode->ul_bit_rate;
 #endif
 #ifndef SIGFOX_EP_TX_POWER_DBM_EIRP
-    sigfox_rfp_test_mode_k_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp,
+    sigfox_rfp_test_mode_k_ctx.test_mode.tx_power_dbm_eirp = rfp_test_mode->tx_power_dbm_eirp;
 #endif
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     sigfox_rfp_test_mode_k_ctx.test_mode.process_cb = rfp_test_mode->process_cb;
     sigfox_rfp_test_mode_k_ctx.test_mode.cplt_cb = rfp_test_mode->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+    sigfox_rfp_test_mode_k_ctx.test_mode.public_key_report = rfp_test_mode->public_key_report;
+    _reset_public_key_report();
 #endif
     sigfox_rfp_test_mode_k_ctx.flags.test_mode_req = 1;
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
@@ -247,8 +478,8 @@ errors:
 }
 
 /*!******************************************************************
- * \fn static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_C_process_fn(void)
- * \brief Process Test Mode C.
+ * \fn static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_K_process_fn(void)
+ * \brief Process Test Mode K.
  * \param[in]   none
  * \param[out]  none
  * \retval      none
@@ -258,44 +489,58 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_K_process_fn(void)
     SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
 #endif
     SIGFOX_EP_API_message_status_t message_status;
-    if (sigfox_rfp_test_mode_k_ctx.flags.test_mode_req == 1) {
-        sigfox_rfp_test_mode_k_ctx.flags.test_mode_req = 0;
+    sfx_u16 tmp;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    // Run the test mode until completion.
+    while (sigfox_rfp_test_mode_k_ctx.progress_status.progress < 100) {
+#endif
+        if (sigfox_rfp_test_mode_k_ctx.flags.test_mode_req == 1) {
+            sigfox_rfp_test_mode_k_ctx.flags.test_mode_req = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-        status = _send_application_message();
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx]);
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-        _send_application_message();
+            MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx]);
 #endif
-    }
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    else {
-        if (sigfox_rfp_test_mode_k_ctx.flags.ep_api_message_cplt == 1) {
+        }
+        else if (sigfox_rfp_test_mode_k_ctx.flags.ep_api_message_cplt == 1) {
             sigfox_rfp_test_mode_k_ctx.flags.ep_api_message_cplt = 0;
             message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+            SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+            SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_PUBLIC_KEY_REPORT
+            _add_public_key_message_status(message_status);
+#endif
             if (message_status.field.execution_error == 1 || message_status.field.network_error) {
                 goto errors;
             }
-            sigfox_rfp_test_mode_k_ctx.progress_status.progress = 100;
-            if (sigfox_rfp_test_mode_k_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
-                sigfox_rfp_test_mode_k_ctx.progress_status.progress = 100;
-                sigfox_rfp_test_mode_k_ctx.test_mode.cplt_cb();
-            }
-        }
-    }
+            sigfox_rfp_test_mode_k_ctx.message_list_idx++;
+            if (sigfox_rfp_test_mode_k_ctx.message_list_idx < MESSAGE_LIST_SIZE) {
+                tmp = 100 * (sigfox_rfp_test_mode_k_ctx.message_list_idx);
+                tmp /= MESSAGE_LIST_SIZE;
+                sigfox_rfp_test_mode_k_ctx.progress_status.progress = (sfx_u8) tmp;
+#ifdef SIGFOX_EP_ERROR_CODES
+                status = MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx]);
+                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-    while (1) {
-        if (sigfox_rfp_test_mode_k_ctx.flags.ep_api_message_cplt == 1) {
-            sigfox_rfp_test_mode_k_ctx.flags.ep_api_message_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error) {
-                goto errors;
+                MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx].send_ptr(&MESSAGE_LIST[sigfox_rfp_test_mode_k_ctx.message_list_idx]);
+#endif
+            } else {
+                sigfox_rfp_test_mode_k_ctx.progress_status.progress = 100;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+                if (sigfox_rfp_test_mode_k_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
+                    sigfox_rfp_test_mode_k_ctx.test_mode.cplt_cb();
+                }
+#endif
             }
-            break;
         }
+#ifndef SIGFOX_EP_ASYNCHRONOUS
     }
-    sigfox_rfp_test_mode_k_ctx.progress_status.progress = 100;
 #endif
-
     SIGFOX_RETURN();
 errors:
     sigfox_rfp_test_mode_k_ctx.progress_status.status.error = 1;
@@ -307,7 +552,7 @@ errors:
 }
 
 /*!******************************************************************
- * \fn static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_C_get_progress_status_fn(void) {
+ * \fn static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_K_get_progress_status_fn(void) {
  * \brief Get the progression status
  * \param[in]   none
  * \param[out]  none
@@ -316,4 +561,28 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_K_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_k_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_K_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode K.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_K_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    plan->number_of_messages = 0;
+    plan->number_of_frames = 0;
+    plan->duration_ms = 0;
+    plan->open_ended = SIGFOX_FALSE;
+    // Back to back messages of the list.
+    for (idx = 0; idx < MESSAGE_LIST_SIZE; idx++) {
+        plan->number_of_messages++;
+        plan->number_of_frames = (sfx_u16) (plan->number_of_frames + SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(3));
+        plan->duration_ms += SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, _get_ul_payload_size_bytes(&(MESSAGE_LIST[idx])), 3, INTERFRAME_MS);
+    }
+}
+#endif
 #endif // SIGFOX_EP_CERTIFICATION
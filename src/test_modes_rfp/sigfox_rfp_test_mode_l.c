@@ -40,8 +40,19 @@
  *******************************************************************/
 
 #include "test_modes_rfp/sigfox_rfp_test_mode_types.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
 #include "sigfox_error.h"
 #include "sigfox_ep_api_test.h"
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+#include "manuf/mcu_api.h"
+#include "test_modes_rfp/sigfox_rfp_nvm.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+#endif
 #ifdef SIGFOX_EP_CERTIFICATION
 
 #ifndef SIGFOX_EP_SINGLE_FRAME
@@ -53,24 +64,40 @@
 #define LOOP 3
 #endif
 
+// Stress cycles replace the certification sequence when requested.
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+#define NUMBER_OF_LOOPS (sigfox_rfp_test_mode_l_ctx.number_of_loops)
+#else
+#define NUMBER_OF_LOOPS LOOP
+#endif
+
 typedef struct {
     struct {
         sfx_u8 ep_api_message_cplt    : 1;
         sfx_u8 test_mode_req          : 1;
     }flags;
     SIGFOX_RFP_test_mode_t test_mode;
-    sfx_u8 loop_iter;
+    sfx_u16 loop_iter;
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    sfx_u16 number_of_loops;
+#endif
     SIGFOX_EP_ADDON_RFP_API_progress_status_t progress_status;
 } SIGFOX_RFP_TEST_MODE_L_context_t;
 
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_L_init_fn(SIGFOX_RFP_test_mode_t *test_mode_callback);
 static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_L_process_fn(void);
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_L_get_progress_status_fn(void);
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+static void SIGFOX_RFP_TEST_MODE_L_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan);
+#endif
 
 const SIGFOX_RFP_test_mode_fn_t SIGFOX_RFP_TEST_MODE_L_fn = {
     .init_fn = &SIGFOX_RFP_TEST_MODE_L_init_fn,
     .process_fn = &SIGFOX_RFP_TEST_MODE_L_process_fn,
     .get_progress_status_fn = &SIGFOX_RFP_TEST_MODE_L_get_progress_status_fn,
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+    .plan_fn = &SIGFOX_RFP_TEST_MODE_L_plan_fn,
+#endif
 };
 
 static SIGFOX_RFP_TEST_MODE_L_context_t sigfox_rfp_test_mode_l_ctx = {
@@ -86,6 +113,10 @@ static SIGFOX_RFP_TEST_MODE_L_context_t sigfox_rfp_test_mode_l_ctx = {
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     .test_mode.process_cb           = SIGFOX_NULL,
     .test_mode.cplt_cb              = SIGFOX_NULL,
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    .test_mode.nvm_stress_cycles    = 0,
+    .number_of_loops                = LOOP,
 #endif
     .loop_iter                      = 0,
     .progress_status.status.error   = 0,
@@ -141,6 +172,12 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
 #endif
 #ifndef SIGFOX_EP_SINGLE_FRAME
     application_message.common_parameters.number_of_frames = 3;
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    // Time compression: the NVM is written once per message whatever the number of frames.
+    if (sigfox_rfp_test_mode_l_ctx.test_mode.nvm_stress_cycles != 0) {
+        application_message.common_parameters.number_of_frames = 1;
+    }
+#endif
 #ifndef SIGFOX_EP_T_IFU_MS
     application_message.common_parameters.t_ifu_ms = INTERFRAME_MS;
 #endif
@@ -187,16 +224,16 @@ static SIGFOX_EP_ADDON_RFP_API_status_t _send_application_message(void) {
     // Send Application message
 #ifdef SIGFOX_EP_ERROR_CODES
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    sigfox_ep_api_status = SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    sigfox_ep_api_status = SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
     SIGFOX_EP_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_EP_API);
 #else
 #ifdef SIGFOX_EP_APPLICATION_MESSAGES
-    SIGFOX_EP_API_TEST_send_application_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_application_message(&application_message, &test_param);
 #else
-    SIGFOX_EP_API_TEST_send_control_message(&application_message, &test_param);
+    SIGFOX_RFP_COMMON_send_control_message(&application_message, &test_param);
 #endif
 #endif
 #ifndef SIGFOX_EP_ASYNCHRONOUS
@@ -208,6 +245,34 @@ errors:
     SIGFOX_RETURN();
 }
 
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+/*!******************************************************************
+ * \fn static SIGFOX_EP_ADDON_RFP_API_status_t _read_message_counter(sfx_u16 *message_counter)
+ * \brief Read the message counter stored in NVM by the EP library.
+ * \param[in]   none
+ * \param[out]  message_counter: Message counter.
+ * \retval      SIGFOX_EP_ADDON_RFP_API_status_t
+ *******************************************************************/
+static SIGFOX_EP_ADDON_RFP_API_status_t _read_message_counter(sfx_u16 *message_counter) {
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+    sfx_u8 nvm_data[SIGFOX_NVM_DATA_SIZE_BYTES] = {0x00};
+#ifdef SIGFOX_EP_ERROR_CODES
+    mcu_api_status = MCU_API_get_nvm(nvm_data, SIGFOX_NVM_DATA_SIZE_BYTES);
+    MCU_API_check_status(SIGFOX_EP_ADDON_RFP_API_ERROR_MCU_API);
+#else
+    MCU_API_get_nvm(nvm_data, SIGFOX_NVM_DATA_SIZE_BYTES);
+#endif
+    (*message_counter) = (sfx_u16) ((((sfx_u16) nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_MSB]) << 8) | nvm_data[SIGFOX_NVM_DATA_INDEX_MESSAGE_COUNTER_LSB]);
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
 /*!******************************************************************
  * \fn static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_L_start_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode)
  * \brief Start Test Mode C.
@@ -219,6 +284,9 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_L_init_fn(SIGFOX_RF
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
 #endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    sfx_u16 message_counter = 0;
+#endif
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
     if (rfp_test_mode == SIGFOX_NULL) {
 #ifdef SIGFOX_EP_ERROR_CODES
@@ -244,9 +312,21 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_L_init_fn(SIGFOX_RF
 #ifdef SIGFOX_EP_ASYNCHRONOUS
     sigfox_rfp_test_mode_l_ctx.test_mode.process_cb = rfp_test_mode->process_cb;
     sigfox_rfp_test_mode_l_ctx.test_mode.cplt_cb = rfp_test_mode->cplt_cb;
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    sigfox_rfp_test_mode_l_ctx.test_mode.nvm_stress_cycles = rfp_test_mode->nvm_stress_cycles;
+    sigfox_rfp_test_mode_l_ctx.number_of_loops = (rfp_test_mode->nvm_stress_cycles != 0) ? rfp_test_mode->nvm_stress_cycles : LOOP;
+    // Reference counter of the consistency check.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _read_message_counter(&message_counter);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+#else
+    _read_message_counter(&message_counter);
+#endif
+    SIGFOX_RFP_NVM_reset(message_counter);
 #endif
     sigfox_rfp_test_mode_l_ctx.flags.test_mode_req = 1;
-#ifdef SIGFOX_EP_PARAMETERS_CHECK
+#if (defined SIGFOX_EP_PARAMETERS_CHECK) || ((defined SIGFOX_EP_ADDON_RFP_NVM_STRESS) && (defined SIGFOX_EP_ERROR_CODES))
 errors:
 #endif
     SIGFOX_RETURN();
@@ -264,32 +344,49 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_L_process_fn(void)
     SIGFOX_EP_ADDON_RFP_API_status_t status = SIGFOX_EP_ADDON_RFP_API_SUCCESS;
 #endif
     SIGFOX_EP_API_message_status_t message_status;
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    sfx_u16 tmp;
+    sfx_u32 tmp;
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    sfx_u16 message_counter = 0;
 #endif
-
-    if (sigfox_rfp_test_mode_l_ctx.flags.test_mode_req == 1) {
-        sigfox_rfp_test_mode_l_ctx.flags.test_mode_req = 0;
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+    // Run the test mode until completion.
+    while (sigfox_rfp_test_mode_l_ctx.progress_status.progress < 100) {
+#endif
+        if (sigfox_rfp_test_mode_l_ctx.flags.test_mode_req == 1) {
+            sigfox_rfp_test_mode_l_ctx.flags.test_mode_req = 0;
 #ifdef SIGFOX_EP_ERROR_CODES
-        status = _send_application_message();
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+            status = _send_application_message();
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
 #else
-        _send_application_message();
+            _send_application_message();
 #endif
-    }
-#ifdef SIGFOX_EP_ASYNCHRONOUS
-    else {
-        if (sigfox_rfp_test_mode_l_ctx.flags.ep_api_message_cplt == 1) {
+        }
+        else if (sigfox_rfp_test_mode_l_ctx.flags.ep_api_message_cplt == 1) {
             sigfox_rfp_test_mode_l_ctx.flags.ep_api_message_cplt = 0;
             message_status = SIGFOX_EP_API_get_message_status();
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+            SIGFOX_RFP_STREAM_add_message_status(message_status);
+#endif
+#ifdef SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE
+            SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(message_status);
+#endif
             if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
                 goto errors;
             }
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = _read_message_counter(&message_counter);
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
+#else
+            _read_message_counter(&message_counter);
+#endif
+            SIGFOX_RFP_NVM_add_cycle(message_counter);
+#endif
             sigfox_rfp_test_mode_l_ctx.loop_iter++;
-            if (sigfox_rfp_test_mode_l_ctx.loop_iter < LOOP) {
-                tmp = 100 * (sigfox_rfp_test_mode_l_ctx.loop_iter);
-                tmp /= LOOP;
-                sigfox_rfp_test_mode_l_ctx.progress_status.progress = (sfx_u8) tmp;
+            tmp = 100 * ((sfx_u32) sigfox_rfp_test_mode_l_ctx.loop_iter);
+            tmp /= NUMBER_OF_LOOPS;
+            sigfox_rfp_test_mode_l_ctx.progress_status.progress = (sfx_u8) tmp;
+            if (sigfox_rfp_test_mode_l_ctx.loop_iter < NUMBER_OF_LOOPS) {
 #ifdef SIGFOX_EP_ERROR_CODES
                 status = _send_application_message();
                 SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
@@ -297,35 +394,17 @@ static SIGFOX_EP_ADDON_RFP_API_status_t SIGFOX_RFP_TEST_MODE_L_process_fn(void)
                 _send_application_message();
 #endif
             } else {
+                sigfox_rfp_test_mode_l_ctx.progress_status.progress = 100;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
                 if (sigfox_rfp_test_mode_l_ctx.test_mode.cplt_cb != SIGFOX_NULL) {
-                    sigfox_rfp_test_mode_l_ctx.progress_status.progress = 100;
                     sigfox_rfp_test_mode_l_ctx.test_mode.cplt_cb();
                 }
-            }
-        }
-    }
-#else
-    while (sigfox_rfp_test_mode_l_ctx.loop_iter < LOOP) {
-        if (sigfox_rfp_test_mode_l_ctx.flags.ep_api_message_cplt == 1) {
-            sigfox_rfp_test_mode_l_ctx.flags.ep_api_message_cplt = 0;
-            message_status = SIGFOX_EP_API_get_message_status();
-            if (message_status.field.execution_error == 1 || message_status.field.network_error == 1) {
-                goto errors;
-            }
-            sigfox_rfp_test_mode_l_ctx.loop_iter++;
-            if (sigfox_rfp_test_mode_l_ctx.loop_iter < LOOP) {
-#ifdef SIGFOX_EP_ERROR_CODES
-                status = _send_application_message();
-                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_RFP_API_SUCCESS);
-#else
-                _send_application_message();
 #endif
             }
         }
+#ifndef SIGFOX_EP_ASYNCHRONOUS
     }
-    sigfox_rfp_test_mode_l_ctx.progress_status.progress = 100;
 #endif
-
     SIGFOX_RETURN();
 errors:
     sigfox_rfp_test_mode_l_ctx.progress_status.status.error = 1;
@@ -346,4 +425,36 @@ errors:
 static SIGFOX_EP_ADDON_RFP_API_progress_status_t SIGFOX_RFP_TEST_MODE_L_get_progress_status_fn(void) {
     return sigfox_rfp_test_mode_l_ctx.progress_status;
 }
+
+#ifdef SIGFOX_EP_ADDON_RFP_PLANNER
+/*!******************************************************************
+ * \fn static void SIGFOX_RFP_TEST_MODE_L_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan)
+ * \brief Compute the expected duration of Test Mode L.
+ * \param[in]   rfp_test_mode: test mode parameters
+ * \param[out]  plan: expected duration and number of messages and frames
+ * \retval      none
+ *******************************************************************/
+static void SIGFOX_RFP_TEST_MODE_L_plan_fn(SIGFOX_RFP_test_mode_t *rfp_test_mode, SIGFOX_EP_ADDON_RFP_API_test_mode_plan_t *plan) {
+    // Local variables.
+#ifdef INTERFRAME_MS
+    sfx_u32 message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 3, INTERFRAME_MS);
+#else
+    sfx_u32 message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 3, 0);
+#endif
+    sfx_u16 number_of_loops = LOOP;
+    sfx_u8 number_of_frames = SIGFOX_RFP_COMMON_NUMBER_OF_FRAMES(3);
+#ifdef SIGFOX_EP_ADDON_RFP_NVM_STRESS
+    if (rfp_test_mode->nvm_stress_cycles != 0) {
+        number_of_loops = rfp_test_mode->nvm_stress_cycles;
+        number_of_frames = 1;
+        message_ms = SIGFOX_RFP_COMMON_get_ul_message_duration_ms(rfp_test_mode, SIGFOX_RFP_COMMON_UL_PAYLOAD_SIZE_BYTES(0), 1, 0);
+    }
+#endif
+    // Back to back messages.
+    plan->number_of_messages = number_of_loops;
+    plan->number_of_frames = (sfx_u16) (number_of_loops * number_of_frames);
+    plan->duration_ms = number_of_loops * message_ms;
+    plan->open_ended = SIGFOX_FALSE;
+}
+#endif
 #endif // SIGFOX_EP_CERTIFICATION
@@ -0,0 +1,227 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_throughput.c
+ * \brief   Sigfox addon RF & Protocol throughput measurement
+ * \details This file compares the completion time of the messages sent by the test modes B and J
+ *          to their nominal duration, to measure the delays added by the spectrum access controls.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include "test_modes_rfp/sigfox_rfp_throughput.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "test_modes_rfp/sigfox_rfp_common.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_THROUGHPUT)
+
+/*** SIGFOX RFP THROUGHPUT local macros ***/
+
+// Delay above the nominal duration which is not attributed to the spectrum access controls (process latency).
+#define SIGFOX_RFP_THROUGHPUT_DEFERRED_THRESHOLD_MS     100
+// Frame rate computed with a 100 ms resolution to keep the product within 32 bits.
+#define SIGFOX_RFP_THROUGHPUT_HOUR_100MS                36000
+
+/*** SIGFOX RFP THROUGHPUT local structures ***/
+
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms;
+    sfx_u32 first_start_ms;
+    sfx_u32 last_end_ms;
+    sfx_u32 message_start_ms;
+    sfx_u32 message_nominal_ms;
+    sfx_u32 added_latency_ms;
+    sfx_u16 number_of_messages;
+    sfx_u16 number_of_frames;
+    sfx_u16 number_of_blocked;
+    sfx_u16 number_of_deferred;
+    sfx_u8 message_started;
+    sfx_u8 message_cplt;
+    sfx_u8 first_started;
+} SIGFOX_RFP_THROUGHPUT_context_t;
+
+/*** SIGFOX RFP THROUGHPUT local global variables ***/
+
+static SIGFOX_RFP_THROUGHPUT_context_t sigfox_rfp_throughput_ctx;
+
+/*** SIGFOX RFP THROUGHPUT local functions ***/
+
+/*!******************************************************************
+ * \fn static void _start_message(const SIGFOX_RFP_COMMON_airtime_t *airtime)
+ * \brief Record the start of a message.
+ * \param[in]   airtime: Durations of the message radio activities.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _start_message(const SIGFOX_RFP_COMMON_airtime_t *airtime) {
+    sigfox_rfp_throughput_ctx.message_start_ms = sigfox_rfp_throughput_ctx.get_time_ms();
+    sigfox_rfp_throughput_ctx.message_nominal_ms = airtime->tx_ms + airtime->ifu_ms + airtime->t_w_ms + airtime->rx_ms;
+    sigfox_rfp_throughput_ctx.message_started = 1;
+    if (sigfox_rfp_throughput_ctx.first_started == 0) {
+        sigfox_rfp_throughput_ctx.first_start_ms = sigfox_rfp_throughput_ctx.message_start_ms;
+        sigfox_rfp_throughput_ctx.last_end_ms = sigfox_rfp_throughput_ctx.message_start_ms;
+        sigfox_rfp_throughput_ctx.first_started = 1;
+    }
+}
+
+/*** SIGFOX RFP THROUGHPUT functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms)
+ * \brief Reset the measurement and select the time source to use.
+ * \param[in]   get_time_ms: Free running millisecond counter.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms) {
+    sigfox_rfp_throughput_ctx.get_time_ms = get_time_ms;
+    sigfox_rfp_throughput_ctx.first_start_ms = 0;
+    sigfox_rfp_throughput_ctx.last_end_ms = 0;
+    sigfox_rfp_throughput_ctx.message_start_ms = 0;
+    sigfox_rfp_throughput_ctx.message_nominal_ms = 0;
+    sigfox_rfp_throughput_ctx.added_latency_ms = 0;
+    sigfox_rfp_throughput_ctx.number_of_messages = 0;
+    sigfox_rfp_throughput_ctx.number_of_frames = 0;
+    sigfox_rfp_throughput_ctx.number_of_blocked = 0;
+    sigfox_rfp_throughput_ctx.number_of_deferred = 0;
+    sigfox_rfp_throughput_ctx.message_started = 0;
+    sigfox_rfp_throughput_ctx.message_cplt = 0;
+    sigfox_rfp_throughput_ctx.first_started = 0;
+}
+
+#ifdef SIGFOX_EP_APPLICATION_MESSAGES
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_start_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Record the request time and the nominal duration of an application message.
+ * \param[in]   application_message: Message about to be sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_start_application_message(const SIGFOX_EP_API_application_message_t *application_message, const SIGFOX_EP_API_TEST_parameters_t *test_param) {
+    // Local variables.
+    SIGFOX_RFP_COMMON_airtime_t airtime;
+    SIGFOX_RFP_COMMON_get_application_message_airtime(application_message, test_param, &airtime);
+    _start_message(&airtime);
+}
+#endif
+
+#ifdef SIGFOX_EP_CONTROL_KEEP_ALIVE_MESSAGE
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_start_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param)
+ * \brief Record the request time and the nominal duration of a control message.
+ * \param[in]   control_message: Message about to be sent.
+ * \param[in]   test_param: Test parameters used to send the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_start_control_message(const SIGFOX_EP_API_control_message_t *control_message, const SIGFOX_EP_API_TEST_parameters_t *test_param) {
+    // Local variables.
+    SIGFOX_RFP_COMMON_airtime_t airtime;
+    SIGFOX_RFP_COMMON_get_control_message_airtime(control_message, test_param, &airtime);
+    _start_message(&airtime);
+}
+#endif
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_message_cplt(void)
+ * \brief Record the completion time of the last started message. Can be called from the message completion callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_message_cplt(void) {
+    if (sigfox_rfp_throughput_ctx.message_started == 0) {
+        return;
+    }
+    sigfox_rfp_throughput_ctx.message_started = 0;
+    sigfox_rfp_throughput_ctx.last_end_ms = sigfox_rfp_throughput_ctx.get_time_ms();
+    sigfox_rfp_throughput_ctx.message_cplt = 1;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_add_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Account the last completed message.
+ * \param[in]   message_status: Status of the completed message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_add_message_status(SIGFOX_EP_API_message_status_t message_status) {
+    // Local variables.
+    sfx_u32 duration_ms = 0;
+    if (sigfox_rfp_throughput_ctx.message_cplt == 0) {
+        return;
+    }
+    sigfox_rfp_throughput_ctx.message_cplt = 0;
+    sigfox_rfp_throughput_ctx.number_of_messages++;
+    sigfox_rfp_throughput_ctx.number_of_frames = (sfx_u16) (sigfox_rfp_throughput_ctx.number_of_frames + message_status.field.ul_frame_1 + message_status.field.ul_frame_2 + message_status.field.ul_frame_3);
+    // A blocked message has no nominal duration to compare to.
+    if (message_status.field.network_error == 1) {
+        sigfox_rfp_throughput_ctx.number_of_blocked++;
+        return;
+    }
+    duration_ms = sigfox_rfp_throughput_ctx.last_end_ms - sigfox_rfp_throughput_ctx.message_start_ms;
+    if (duration_ms > sigfox_rfp_throughput_ctx.message_nominal_ms) {
+        sigfox_rfp_throughput_ctx.added_latency_ms += duration_ms - sigfox_rfp_throughput_ctx.message_nominal_ms;
+        if ((duration_ms - sigfox_rfp_throughput_ctx.message_nominal_ms) > SIGFOX_RFP_THROUGHPUT_DEFERRED_THRESHOLD_MS) {
+            sigfox_rfp_throughput_ctx.number_of_deferred++;
+        }
+    }
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_THROUGHPUT_get_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report)
+ * \brief Get the measurement of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  throughput_report: Achieved frame rate, blocked and deferred messages and added latency.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_THROUGHPUT_get_report(SIGFOX_EP_ADDON_RFP_API_throughput_report_t *throughput_report) {
+    // Local variables.
+    sfx_u16 number_of_sent = (sfx_u16) (sigfox_rfp_throughput_ctx.number_of_messages - sigfox_rfp_throughput_ctx.number_of_blocked);
+    throughput_report->elapsed_ms = sigfox_rfp_throughput_ctx.last_end_ms - sigfox_rfp_throughput_ctx.first_start_ms;
+    throughput_report->number_of_messages = sigfox_rfp_throughput_ctx.number_of_messages;
+    throughput_report->number_of_frames = sigfox_rfp_throughput_ctx.number_of_frames;
+    throughput_report->number_of_blocked = sigfox_rfp_throughput_ctx.number_of_blocked;
+    throughput_report->number_of_deferred = sigfox_rfp_throughput_ctx.number_of_deferred;
+    throughput_report->frames_per_hour = 0;
+    if ((throughput_report->elapsed_ms / 100) != 0) {
+        throughput_report->frames_per_hour = (((sfx_u32) sigfox_rfp_throughput_ctx.number_of_frames) * SIGFOX_RFP_THROUGHPUT_HOUR_100MS) / (throughput_report->elapsed_ms / 100);
+    }
+    throughput_report->mean_added_latency_ms = (number_of_sent != 0) ? (sigfox_rfp_throughput_ctx.added_latency_ms / number_of_sent) : 0;
+}
+
+#endif /* SIGFOX_EP_CERTIFICATION && SIGFOX_EP_ADDON_RFP_THROUGHPUT */
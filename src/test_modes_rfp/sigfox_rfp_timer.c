@@ -0,0 +1,370 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_timer.c
+ * \brief   Sigfox RFP timer wheel.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "test_modes_rfp/sigfox_rfp_timer.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "manuf/mcu_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_TIMER_WHEEL)
+
+/*** SIGFOX RFP TIMER local macros ***/
+
+// Shortest MCU timer duration.
+#define SIGFOX_RFP_TIMER_MIN_DURATION_MS    1
+
+/*** SIGFOX RFP TIMER local structures ***/
+
+typedef struct {
+    sfx_u32 expiry_ms;
+    SIGFOX_RFP_TIMER_cplt_cb_t cplt_cb;
+    sfx_u8 running;
+} SIGFOX_RFP_TIMER_timer_t;
+
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    SIGFOX_RFP_TIMER_process_cb_t process_cb;
+#endif
+    SIGFOX_RFP_TIMER_timer_t timers[SIGFOX_RFP_TIMER_ID_LAST];
+    sfx_u32 armed_expiry_ms;
+    sfx_u8 armed;
+    sfx_u8 armed_generation; /*!< Incremented each time the MCU timer is started */
+    volatile sfx_u8 expired_generation; /*!< Generation of the last MCU timer expiration */
+} SIGFOX_RFP_TIMER_context_t;
+
+/*** SIGFOX RFP TIMER local global variables ***/
+
+static SIGFOX_RFP_TIMER_context_t sigfox_rfp_timer_ctx;
+
+/*** SIGFOX RFP TIMER local functions ***/
+
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn static void _MCU_API_timer_cplt_cb(void)
+ * \brief MCU timer completion callback.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _MCU_API_timer_cplt_cb(void) {
+    // An expiration queued before a stop or a restart keeps the generation of its own arming.
+    sigfox_rfp_timer_ctx.expired_generation = sigfox_rfp_timer_ctx.armed_generation;
+    if (sigfox_rfp_timer_ctx.process_cb != SIGFOX_NULL) {
+        sigfox_rfp_timer_ctx.process_cb();
+    }
+}
+#endif
+
+/*!******************************************************************
+ * \fn static sfx_u32 _get_time_ms(void)
+ * \brief Read the time source.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current time in ms, 0 if there is no time source.
+ *******************************************************************/
+static sfx_u32 _get_time_ms(void) {
+    return (sigfox_rfp_timer_ctx.get_time_ms != SIGFOX_NULL) ? sigfox_rfp_timer_ctx.get_time_ms() : 0;
+}
+
+/*!******************************************************************
+ * \fn static sfx_bool _is_before(sfx_u32 time_a_ms, sfx_u32 time_b_ms)
+ * \brief Compare two times, handling the counter wrapping.
+ * \param[in]   time_a_ms: First time.
+ * \param[in]   time_b_ms: Second time.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the first time is before the second one, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+static sfx_bool _is_before(sfx_u32 time_a_ms, sfx_u32 time_b_ms) {
+    // Counter wrapping is handled by the signed difference.
+    return (((sfx_s32) (time_a_ms - time_b_ms)) < 0) ? SIGFOX_TRUE : SIGFOX_FALSE;
+}
+
+/*!******************************************************************
+ * \fn static MCU_API_status_t _rearm(sfx_u32 now_ms)
+ * \brief Arm the MCU timer on the nearest expiration of the logical timers, or release it if none is running.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+static MCU_API_status_t _rearm(sfx_u32 now_ms) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+    MCU_API_timer_t timer;
+    sfx_u32 nearest_expiry_ms = 0;
+    sfx_bool nearest_found = SIGFOX_FALSE;
+    sfx_u8 idx = 0;
+    // Search the nearest deadline.
+    for (idx = 0; idx < SIGFOX_RFP_TIMER_ID_LAST; idx++) {
+        if (sigfox_rfp_timer_ctx.timers[idx].running == 0) {
+            continue;
+        }
+        if ((nearest_found == SIGFOX_FALSE) || (_is_before(sigfox_rfp_timer_ctx.timers[idx].expiry_ms, nearest_expiry_ms) == SIGFOX_TRUE)) {
+            nearest_expiry_ms = sigfox_rfp_timer_ctx.timers[idx].expiry_ms;
+            nearest_found = SIGFOX_TRUE;
+        }
+    }
+    if (nearest_found == SIGFOX_FALSE) {
+        // No more logical timer: release the MCU timer.
+        if (sigfox_rfp_timer_ctx.armed != 0) {
+            sigfox_rfp_timer_ctx.armed = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+            return MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+#else
+            MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+#endif
+        }
+        goto end;
+    }
+    // Keep the MCU timer if it expires before or with the nearest deadline (it will be re-armed on expiration).
+    if ((sigfox_rfp_timer_ctx.armed != 0) && (_is_before(nearest_expiry_ms, sigfox_rfp_timer_ctx.armed_expiry_ms) == SIGFOX_FALSE)) {
+        goto end;
+    }
+    if (sigfox_rfp_timer_ctx.armed != 0) {
+        sigfox_rfp_timer_ctx.armed = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+        mcu_api_status = MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+        if (mcu_api_status != MCU_API_SUCCESS) {
+            return mcu_api_status;
+        }
+#else
+        MCU_API_timer_stop(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+#endif
+    }
+    // Arm the MCU timer for the nearest deadline.
+    timer.instance = MCU_API_TIMER_INSTANCE_ADDON_RFP;
+    timer.reason = MCU_API_TIMER_REASON_ADDON_RFP;
+    timer.duration_ms = (_is_before(now_ms, nearest_expiry_ms) == SIGFOX_TRUE) ? (nearest_expiry_ms - now_ms) : 0;
+    if (timer.duration_ms < SIGFOX_RFP_TIMER_MIN_DURATION_MS) {
+        timer.duration_ms = SIGFOX_RFP_TIMER_MIN_DURATION_MS;
+    }
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    timer.cplt_cb = &_MCU_API_timer_cplt_cb;
+#endif
+    sigfox_rfp_timer_ctx.armed_generation++;
+#ifdef SIGFOX_EP_ERROR_CODES
+    mcu_api_status = MCU_API_timer_start(&timer);
+    if (mcu_api_status != MCU_API_SUCCESS) {
+        return mcu_api_status;
+    }
+#else
+    MCU_API_timer_start(&timer);
+#endif
+    sigfox_rfp_timer_ctx.armed_expiry_ms = now_ms + timer.duration_ms;
+    sigfox_rfp_timer_ctx.armed = 1;
+end:
+#ifdef SIGFOX_EP_ERROR_CODES
+    return MCU_API_SUCCESS;
+#else
+    return;
+#endif
+}
+
+/*** SIGFOX RFP TIMER functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_TIMER_init(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms, SIGFOX_RFP_TIMER_process_cb_t process_cb)
+ * \brief Reset all the logical timers.
+ * \param[in]   get_time_ms: Free running millisecond counter used to compute the deadlines.
+ * \param[in]   process_cb: Process callback (asynchronous mode only).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+void SIGFOX_RFP_TIMER_init(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms, SIGFOX_RFP_TIMER_process_cb_t process_cb) {
+#else
+void SIGFOX_RFP_TIMER_init(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms) {
+#endif
+    // Local variables.
+    sfx_u8 idx = 0;
+    sigfox_rfp_timer_ctx.get_time_ms = get_time_ms;
+#ifdef SIGFOX_EP_ASYNCHRONOUS
+    sigfox_rfp_timer_ctx.process_cb = process_cb;
+#endif
+    for (idx = 0; idx < SIGFOX_RFP_TIMER_ID_LAST; idx++) {
+        sigfox_rfp_timer_ctx.timers[idx].expiry_ms = 0;
+        sigfox_rfp_timer_ctx.timers[idx].cplt_cb = SIGFOX_NULL;
+        sigfox_rfp_timer_ctx.timers[idx].running = 0;
+    }
+    sigfox_rfp_timer_ctx.armed_expiry_ms = 0;
+    sigfox_rfp_timer_ctx.armed = 0;
+    sigfox_rfp_timer_ctx.armed_generation = 0;
+    sigfox_rfp_timer_ctx.expired_generation = 0;
+}
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_id_t timer_id, sfx_u32 duration_ms, SIGFOX_RFP_TIMER_cplt_cb_t cplt_cb)
+ * \brief Start (or restart) a logical timer. The MCU timer is only re-armed if the nearest deadline changes.
+ * \param[in]   timer_id: Logical timer to start.
+ * \param[in]   duration_ms: Timer duration.
+ * \param[in]   cplt_cb: Callback called when the timer expires.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_start(SIGFOX_RFP_TIMER_id_t timer_id, sfx_u32 duration_ms, SIGFOX_RFP_TIMER_cplt_cb_t cplt_cb) {
+    // Local variables.
+    sfx_u32 now_ms = _get_time_ms();
+    sigfox_rfp_timer_ctx.timers[timer_id].expiry_ms = now_ms + duration_ms;
+    sigfox_rfp_timer_ctx.timers[timer_id].cplt_cb = cplt_cb;
+    sigfox_rfp_timer_ctx.timers[timer_id].running = 1;
+#ifdef SIGFOX_EP_ERROR_CODES
+    return _rearm(now_ms);
+#else
+    _rearm(now_ms);
+#endif
+}
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_id_t timer_id)
+ * \brief Stop a logical timer. The MCU timer is stopped when no logical timer is running anymore.
+ * \param[in]   timer_id: Logical timer to stop.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_stop(SIGFOX_RFP_TIMER_id_t timer_id) {
+    sigfox_rfp_timer_ctx.timers[timer_id].running = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    return _rearm(_get_time_ms());
+#else
+    _rearm(_get_time_ms());
+#endif
+}
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_stop_all(void)
+ * \brief Stop all the logical timers and the MCU timer.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_stop_all(void) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    for (idx = 0; idx < SIGFOX_RFP_TIMER_ID_LAST; idx++) {
+        sigfox_rfp_timer_ctx.timers[idx].running = 0;
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    return _rearm(_get_time_ms());
+#else
+    _rearm(_get_time_ms());
+#endif
+}
+
+/*!******************************************************************
+ * \fn sfx_bool SIGFOX_RFP_TIMER_is_running(SIGFOX_RFP_TIMER_id_t timer_id)
+ * \brief Indicate if a logical timer is running.
+ * \param[in]   timer_id: Logical timer to check.
+ * \param[out]  none
+ * \retval      SIGFOX_TRUE if the timer is running, SIGFOX_FALSE otherwise.
+ *******************************************************************/
+sfx_bool SIGFOX_RFP_TIMER_is_running(SIGFOX_RFP_TIMER_id_t timer_id) {
+    return (sigfox_rfp_timer_ctx.timers[timer_id].running == 0) ? SIGFOX_FALSE : SIGFOX_TRUE;
+}
+
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_process(void)
+ * \brief Call the callbacks of the expired logical timers and re-arm the MCU timer for the nearest deadline.
+ * \brief Has to be called after each MCU timer expiration.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_process(void) {
+    // Local variables.
+    sfx_u32 now_ms = _get_time_ms();
+    sfx_u8 idx = 0;
+    // The MCU timer is only released when the expiration belongs to its current arming, a stale one leaves it running.
+    if ((sigfox_rfp_timer_ctx.armed != 0) && (sigfox_rfp_timer_ctx.expired_generation == sigfox_rfp_timer_ctx.armed_generation)) {
+        sigfox_rfp_timer_ctx.armed = 0;
+    }
+    for (idx = 0; idx < SIGFOX_RFP_TIMER_ID_LAST; idx++) {
+        if ((sigfox_rfp_timer_ctx.timers[idx].running != 0) && (_is_before(now_ms, sigfox_rfp_timer_ctx.timers[idx].expiry_ms) == SIGFOX_FALSE)) {
+            sigfox_rfp_timer_ctx.timers[idx].running = 0;
+            if (sigfox_rfp_timer_ctx.timers[idx].cplt_cb != SIGFOX_NULL) {
+                sigfox_rfp_timer_ctx.timers[idx].cplt_cb();
+            }
+        }
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    return _rearm(_get_time_ms());
+#else
+    _rearm(_get_time_ms());
+#endif
+}
+
+#ifndef SIGFOX_EP_ASYNCHRONOUS
+/*!******************************************************************
+ * \fn MCU_API_status_t SIGFOX_RFP_TIMER_wait_cplt(SIGFOX_RFP_TIMER_id_t timer_id)
+ * \brief Block until a logical timer expires. The other logical timers expiring in the meantime are processed.
+ * \param[in]   timer_id: Logical timer to wait for.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MCU_API_status_t SIGFOX_RFP_TIMER_wait_cplt(SIGFOX_RFP_TIMER_id_t timer_id) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+    while (sigfox_rfp_timer_ctx.timers[timer_id].running != 0) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        mcu_api_status = MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+        if (mcu_api_status != MCU_API_SUCCESS) {
+            return mcu_api_status;
+        }
+        sigfox_rfp_timer_ctx.expired_generation = sigfox_rfp_timer_ctx.armed_generation;
+        mcu_api_status = SIGFOX_RFP_TIMER_process();
+        if (mcu_api_status != MCU_API_SUCCESS) {
+            return mcu_api_status;
+        }
+#else
+        MCU_API_timer_wait_cplt(MCU_API_TIMER_INSTANCE_ADDON_RFP);
+        sigfox_rfp_timer_ctx.expired_generation = sigfox_rfp_timer_ctx.armed_generation;
+        SIGFOX_RFP_TIMER_process();
+#endif
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    return mcu_api_status;
+#endif
+}
+#endif
+
+#endif
@@ -0,0 +1,237 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_uplink_timing.c
+ * \brief   Sigfox addon RF & Protocol uplink timing
+ * \details This file timestamps the send call, the uplink completion and the message completion
+ *          of each message sent by the test modes.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include "test_modes_rfp/sigfox_rfp_uplink_timing.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_UPLINK_TIMING)
+
+/*** SIGFOX RFP UPLINK TIMING local structures ***/
+
+typedef struct {
+    SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms;
+    // Callbacks of the test mode, called after the timestamp.
+    SIGFOX_EP_API_uplink_cplt_cb_t uplink_cplt_cb;
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb;
+    SIGFOX_EP_ADDON_RFP_API_uplink_timestamps_t current;
+    SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t report;
+} SIGFOX_RFP_UPLINK_TIMING_context_t;
+
+/*** SIGFOX RFP UPLINK TIMING local global variables ***/
+
+static SIGFOX_RFP_UPLINK_TIMING_context_t sigfox_rfp_uplink_timing_ctx;
+
+/*** SIGFOX RFP UPLINK TIMING local functions ***/
+
+/*!******************************************************************
+ * \fn static sfx_u32 _get_time_ms(void)
+ * \brief Read the time source.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current time in ms, 0 if there is no time source.
+ *******************************************************************/
+static sfx_u32 _get_time_ms(void) {
+    return (sigfox_rfp_uplink_timing_ctx.get_time_ms != SIGFOX_NULL) ? sigfox_rfp_uplink_timing_ctx.get_time_ms() : 0;
+}
+
+/*!******************************************************************
+ * \fn static void _update_range(sfx_u32 duration_ms, sfx_u32 number_of_values, sfx_u32 *min_ms, sfx_u32 *max_ms)
+ * \brief Update a minimum and maximum with a new duration.
+ * \param[in]   duration_ms: New duration.
+ * \param[in]   number_of_values: Number of durations already measured.
+ * \param[out]  min_ms: Minimum duration.
+ * \param[out]  max_ms: Maximum duration.
+ * \retval      none
+ *******************************************************************/
+static void _update_range(sfx_u32 duration_ms, sfx_u32 number_of_values, sfx_u32 *min_ms, sfx_u32 *max_ms) {
+    if ((number_of_values == 0) || (duration_ms < (*min_ms))) {
+        (*min_ms) = duration_ms;
+    }
+    if (duration_ms > (*max_ms)) {
+        (*max_ms) = duration_ms;
+    }
+}
+
+/*!******************************************************************
+ * \fn static void _uplink_cplt_cb(void)
+ * \brief Uplink completion callback, which measures the uplink phase.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _uplink_cplt_cb(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *report = &(sigfox_rfp_uplink_timing_ctx.report);
+    SIGFOX_EP_ADDON_RFP_API_uplink_timestamps_t *current = &(sigfox_rfp_uplink_timing_ctx.current);
+    sfx_u32 uplink_ms = 0;
+    sfx_s32 deviation_ms = 0;
+    current->uplink_end_ms = _get_time_ms();
+    current->uplink_cplt = SIGFOX_TRUE;
+    // Unsigned difference to support the wrapping of the time source.
+    uplink_ms = current->uplink_end_ms - current->send_ms;
+    deviation_ms = (sfx_s32) (uplink_ms - current->expected_uplink_ms);
+    if ((report->number_of_uplinks == 0) || (deviation_ms < report->uplink_deviation_min_ms)) {
+        report->uplink_deviation_min_ms = deviation_ms;
+    }
+    if ((report->number_of_uplinks == 0) || (deviation_ms > report->uplink_deviation_max_ms)) {
+        report->uplink_deviation_max_ms = deviation_ms;
+    }
+    _update_range(uplink_ms, report->number_of_uplinks, &(report->uplink_min_ms), &(report->uplink_max_ms));
+    report->number_of_uplinks++;
+    if (sigfox_rfp_uplink_timing_ctx.uplink_cplt_cb != SIGFOX_NULL) {
+        sigfox_rfp_uplink_timing_ctx.uplink_cplt_cb();
+    }
+}
+
+/*!******************************************************************
+ * \fn static void _message_cplt_cb(void)
+ * \brief Message completion callback, which measures the downlink phase and the whole message.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static void _message_cplt_cb(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *report = &(sigfox_rfp_uplink_timing_ctx.report);
+    SIGFOX_EP_ADDON_RFP_API_uplink_timestamps_t *current = &(sigfox_rfp_uplink_timing_ctx.current);
+    SIGFOX_EP_API_message_cplt_cb_t message_cplt_cb = sigfox_rfp_uplink_timing_ctx.message_cplt_cb;
+    current->message_end_ms = _get_time_ms();
+    // The downlink phase is only measured after a notified uplink.
+    if (current->uplink_cplt == SIGFOX_TRUE) {
+        _update_range((current->message_end_ms - current->uplink_end_ms), report->number_of_downlinks, &(report->downlink_min_ms), &(report->downlink_max_ms));
+        report->number_of_downlinks++;
+    }
+    _update_range((current->message_end_ms - current->send_ms), report->number_of_messages, &(report->message_min_ms), &(report->message_max_ms));
+    report->number_of_messages++;
+    report->last = (*current);
+    sigfox_rfp_uplink_timing_ctx.uplink_cplt_cb = SIGFOX_NULL;
+    sigfox_rfp_uplink_timing_ctx.message_cplt_cb = SIGFOX_NULL;
+    if (message_cplt_cb != SIGFOX_NULL) {
+        message_cplt_cb();
+    }
+}
+
+/*** SIGFOX RFP UPLINK TIMING functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms)
+ * \brief Reset the statistics.
+ * \param[in]   get_time_ms: Time source of the addon.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_reset(SIGFOX_EP_ADDON_RFP_API_get_time_ms_cb_t get_time_ms) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *report = &(sigfox_rfp_uplink_timing_ctx.report);
+    sigfox_rfp_uplink_timing_ctx.get_time_ms = get_time_ms;
+    sigfox_rfp_uplink_timing_ctx.uplink_cplt_cb = SIGFOX_NULL;
+    sigfox_rfp_uplink_timing_ctx.message_cplt_cb = SIGFOX_NULL;
+    sigfox_rfp_uplink_timing_ctx.current.send_ms = 0;
+    sigfox_rfp_uplink_timing_ctx.current.uplink_end_ms = 0;
+    sigfox_rfp_uplink_timing_ctx.current.message_end_ms = 0;
+    sigfox_rfp_uplink_timing_ctx.current.expected_uplink_ms = 0;
+    sigfox_rfp_uplink_timing_ctx.current.uplink_cplt = SIGFOX_FALSE;
+    report->number_of_messages = 0;
+    report->number_of_uplinks = 0;
+    report->number_of_downlinks = 0;
+    report->uplink_min_ms = 0;
+    report->uplink_max_ms = 0;
+    report->uplink_deviation_min_ms = 0;
+    report->uplink_deviation_max_ms = 0;
+    report->downlink_min_ms = 0;
+    report->downlink_max_ms = 0;
+    report->message_min_ms = 0;
+    report->message_max_ms = 0;
+    report->last = sigfox_rfp_uplink_timing_ctx.current;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_start_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb, sfx_u32 expected_uplink_ms)
+ * \brief Timestamp the send call and route the uplink and message completions of the message through the timing callbacks.
+ * \param[in]   uplink_cplt_cb: Uplink completion callback of the message, replaced by the timing callback.
+ * \param[in]   message_cplt_cb: Message completion callback of the message, replaced by the timing callback.
+ * \param[in]   expected_uplink_ms: On-air time of the frames and inter-frame delays computed from the message parameters.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_start_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb, sfx_u32 expected_uplink_ms) {
+    sigfox_rfp_uplink_timing_ctx.uplink_cplt_cb = (*uplink_cplt_cb);
+    sigfox_rfp_uplink_timing_ctx.message_cplt_cb = (*message_cplt_cb);
+    (*uplink_cplt_cb) = &_uplink_cplt_cb;
+    (*message_cplt_cb) = &_message_cplt_cb;
+    sigfox_rfp_uplink_timing_ctx.current.expected_uplink_ms = expected_uplink_ms;
+    sigfox_rfp_uplink_timing_ctx.current.uplink_cplt = SIGFOX_FALSE;
+    sigfox_rfp_uplink_timing_ctx.current.send_ms = _get_time_ms();
+    sigfox_rfp_uplink_timing_ctx.current.uplink_end_ms = sigfox_rfp_uplink_timing_ctx.current.send_ms;
+    sigfox_rfp_uplink_timing_ctx.current.message_end_ms = sigfox_rfp_uplink_timing_ctx.current.send_ms;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_cancel_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb)
+ * \brief Give back the callbacks of a message which could not be sent.
+ * \param[in]   uplink_cplt_cb: Uplink completion callback of the message.
+ * \param[in]   message_cplt_cb: Message completion callback of the message.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_cancel_message(SIGFOX_EP_API_uplink_cplt_cb_t *uplink_cplt_cb, SIGFOX_EP_API_message_cplt_cb_t *message_cplt_cb) {
+    (*uplink_cplt_cb) = sigfox_rfp_uplink_timing_ctx.uplink_cplt_cb;
+    (*message_cplt_cb) = sigfox_rfp_uplink_timing_ctx.message_cplt_cb;
+    sigfox_rfp_uplink_timing_ctx.uplink_cplt_cb = SIGFOX_NULL;
+    sigfox_rfp_uplink_timing_ctx.message_cplt_cb = SIGFOX_NULL;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_UPLINK_TIMING_get_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report)
+ * \brief Get the statistics of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  uplink_timing_report: Pointer to the report to fill.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_UPLINK_TIMING_get_report(SIGFOX_EP_ADDON_RFP_API_uplink_timing_report_t *uplink_timing_report) {
+    (*uplink_timing_report) = sigfox_rfp_uplink_timing_ctx.report;
+}
+
+#endif /* SIGFOX_EP_CERTIFICATION && SIGFOX_EP_ADDON_RFP_UPLINK_TIMING */
@@ -0,0 +1,177 @@
+/*!*****************************************************************
+ * \file    sigfox_rfp_voltage_temperature.c
+ * \brief   Sigfox addon RF & Protocol supply voltage and temperature capture
+ * \details This file samples the supply voltage and the temperature given by the MCU driver
+ *          after each message of the test modes.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2026, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include "test_modes_rfp/sigfox_rfp_voltage_temperature.h"
+
+#ifndef SIGFOX_EP_DISABLE_FLAGS_FILE
+#include "sigfox_ep_flags.h"
+#endif
+#include "sigfox_types.h"
+#include "sigfox_ep_api.h"
+#include "sigfox_ep_addon_rfp_api.h"
+#include "manuf/mcu_api.h"
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+#include "test_modes_rfp/sigfox_rfp_stream.h"
+#endif
+
+#if (defined SIGFOX_EP_CERTIFICATION) && (defined SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE)
+
+/*** SIGFOX RFP VOLTAGE TEMPERATURE local structures ***/
+
+typedef struct {
+    sfx_bool enable;
+    SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t report;
+} SIGFOX_RFP_VOLTAGE_TEMPERATURE_context_t;
+
+/*** SIGFOX RFP VOLTAGE TEMPERATURE local global variables ***/
+
+static SIGFOX_RFP_VOLTAGE_TEMPERATURE_context_t sigfox_rfp_voltage_temperature_ctx;
+
+/*** SIGFOX RFP VOLTAGE TEMPERATURE functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_VOLTAGE_TEMPERATURE_reset(sfx_bool enable)
+ * \brief Reset the statistics.
+ * \param[in]   enable: Sample the voltage and temperature after each message of the test mode.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_VOLTAGE_TEMPERATURE_reset(sfx_bool enable) {
+    // Local variables.
+    SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *report = &(sigfox_rfp_voltage_temperature_ctx.report);
+    sigfox_rfp_voltage_temperature_ctx.enable = enable;
+    report->number_of_samples = 0;
+    report->number_of_tx_samples = 0;
+    report->number_of_errors = 0;
+    report->voltage_idle_min_mv = 0;
+    report->voltage_idle_max_mv = 0;
+    report->voltage_tx_min_mv = 0;
+    report->voltage_tx_max_mv = 0;
+    report->voltage_droop_max_mv = 0;
+    report->temperature_min_tenth_degrees = 0;
+    report->temperature_max_tenth_degrees = 0;
+    report->first.voltage_idle_mv = 0;
+    report->first.voltage_tx_mv = 0;
+    report->first.temperature_tenth_degrees = 0;
+    report->last = report->first;
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(SIGFOX_EP_API_message_status_t message_status)
+ * \brief Sample the voltage and temperature after a completed message. The TX voltage is only accounted when an uplink frame was sent.
+ * \param[in]   message_status: Status reported by the EP library.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_VOLTAGE_TEMPERATURE_add_message_status(SIGFOX_EP_API_message_status_t message_status) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    MCU_API_status_t mcu_api_status = MCU_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *report = &(sigfox_rfp_voltage_temperature_ctx.report);
+    SIGFOX_EP_ADDON_RFP_API_voltage_temperature_t sample = { 0, 0, 0 };
+    sfx_bool tx_sample = SIGFOX_FALSE;
+    if (sigfox_rfp_voltage_temperature_ctx.enable == SIGFOX_FALSE) {
+        return;
+    }
+    // A failed measurement is counted but does not end the test mode.
+#ifdef SIGFOX_EP_ERROR_CODES
+    mcu_api_status = MCU_API_get_voltage_temperature(&(sample.voltage_idle_mv), &(sample.voltage_tx_mv), &(sample.temperature_tenth_degrees));
+    if (mcu_api_status != MCU_API_SUCCESS) {
+        report->number_of_errors++;
+        return;
+    }
+#else
+    MCU_API_get_voltage_temperature(&(sample.voltage_idle_mv), &(sample.voltage_tx_mv), &(sample.temperature_tenth_degrees));
+#endif
+    // The TX voltage is the one of the last uplink frame, it is outdated for a receive only message.
+    tx_sample = ((message_status.field.ul_frame_1 == 1) || (message_status.field.ul_frame_2 == 1) || (message_status.field.ul_frame_3 == 1)) ? SIGFOX_TRUE : SIGFOX_FALSE;
+    if (tx_sample == SIGFOX_FALSE) {
+        sample.voltage_tx_mv = 0;
+    }
+    if (report->number_of_samples == 0) {
+        report->first = sample;
+        report->voltage_idle_min_mv = sample.voltage_idle_mv;
+        report->voltage_idle_max_mv = sample.voltage_idle_mv;
+        report->temperature_min_tenth_degrees = sample.temperature_tenth_degrees;
+        report->temperature_max_tenth_degrees = sample.temperature_tenth_degrees;
+    }
+    if (sample.voltage_idle_mv < report->voltage_idle_min_mv) {
+        report->voltage_idle_min_mv = sample.voltage_idle_mv;
+    }
+    if (sample.voltage_idle_mv > report->voltage_idle_max_mv) {
+        report->voltage_idle_max_mv = sample.voltage_idle_mv;
+    }
+    if (sample.temperature_tenth_degrees < report->temperature_min_tenth_degrees) {
+        report->temperature_min_tenth_degrees = sample.temperature_tenth_degrees;
+    }
+    if (sample.temperature_tenth_degrees > report->temperature_max_tenth_degrees) {
+        report->temperature_max_tenth_degrees = sample.temperature_tenth_degrees;
+    }
+    if (tx_sample == SIGFOX_TRUE) {
+        if ((report->number_of_tx_samples == 0) || (sample.voltage_tx_mv < report->voltage_tx_min_mv)) {
+            report->voltage_tx_min_mv = sample.voltage_tx_mv;
+        }
+        if (sample.voltage_tx_mv > report->voltage_tx_max_mv) {
+            report->voltage_tx_max_mv = sample.voltage_tx_mv;
+        }
+        if ((sample.voltage_idle_mv > sample.voltage_tx_mv) && ((sfx_u16) (sample.voltage_idle_mv - sample.voltage_tx_mv) > report->voltage_droop_max_mv)) {
+            report->voltage_droop_max_mv = (sfx_u16) (sample.voltage_idle_mv - sample.voltage_tx_mv);
+        }
+        report->number_of_tx_samples++;
+    }
+    report->last = sample;
+    report->number_of_samples++;
+#ifdef SIGFOX_EP_ADDON_RFP_RESULT_STREAM
+    SIGFOX_RFP_STREAM_add_voltage_temperature(sample.voltage_idle_mv, sample.voltage_tx_mv, sample.temperature_tenth_degrees);
+#endif
+}
+
+/*!******************************************************************
+ * \fn void SIGFOX_RFP_VOLTAGE_TEMPERATURE_get_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report)
+ * \brief Get the statistics of the current or last test mode.
+ * \param[in]   none
+ * \param[out]  voltage_temperature_report: Pointer to the report to fill.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_RFP_VOLTAGE_TEMPERATURE_get_report(SIGFOX_EP_ADDON_RFP_API_voltage_temperature_report_t *voltage_temperature_report) {
+    (*voltage_temperature_report) = sigfox_rfp_voltage_temperature_ctx.report;
+}
+
+#endif /* SIGFOX_EP_CERTIFICATION && SIGFOX_EP_ADDON_RFP_VOLTAGE_TEMPERATURE */